@@ -27,6 +27,7 @@ namespace duckdb {
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::PageType;
 using duckdb_parquet::format::Type;
 
@@ -183,6 +184,184 @@ unique_ptr<BaseStatistics> ColumnReader::Stats(idx_t row_group_idx_p, const vect
 	return ParquetStatisticsUtils::TransformColumnStatistics(*this, columns);
 }
 
+unique_ptr<BaseStatistics> ColumnReader::PageStats(const ColumnIndex &column_index, idx_t page_idx) {
+	return ParquetStatisticsUtils::TransformPageStatistics(*this, column_index, page_idx);
+}
+
+void ColumnReader::ReadPageIndex(duckdb_apache::thrift::TBase &object, int64_t offset) {
+	// the page index is stored before the footer, restore the location of the pages afterwards
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	auto location = trans.GetLocation();
+	trans.SetLocation(offset);
+	reader.Read(object, *protocol);
+	trans.SetLocation(location);
+}
+
+const OffsetIndex *ColumnReader::GetOffsetIndex() {
+	if (offset_index) {
+		return offset_index.get();
+	}
+	// the page index of encrypted files is encrypted with its own module keys, which we do not support
+	if (!chunk || !chunk->__isset.offset_index_offset || HasRepeats() || reader.parquet_options.encryption_config) {
+		return nullptr;
+	}
+	offset_index = make_uniq<OffsetIndex>();
+	ReadPageIndex(*offset_index, chunk->offset_index_offset);
+	return offset_index.get();
+}
+
+bool ColumnReader::ReadColumnIndex(ColumnIndex &column_index) {
+	if (!chunk || !chunk->__isset.column_index_offset || reader.parquet_options.encryption_config) {
+		return false;
+	}
+	ReadPageIndex(column_index, chunk->column_index_offset);
+	return true;
+}
+
+bool ColumnReader::BloomFilterExcludes(const vector<ColumnChunk> &columns, TProtocol &file_proto,
+                                       const TableFilter &filter) {
+	// like the page index, the bloom filters of encrypted files are encrypted with their own module keys
+	if (type.IsNested() || file_idx >= columns.size() || reader.parquet_options.encryption_config ||
+	    !ParquetStatisticsUtils::BloomFilterSupported(filter)) {
+		return false;
+	}
+	auto &column_chunk = columns[file_idx];
+	if (!column_chunk.__isset.meta_data || !column_chunk.meta_data.__isset.bloom_filter_offset) {
+		return false;
+	}
+	auto &meta_data = column_chunk.meta_data;
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*file_proto.getTransport());
+	if (meta_data.bloom_filter_offset < 0 || idx_t(meta_data.bloom_filter_offset) >= trans.GetSize()) {
+		return false;
+	}
+	auto location = trans.GetLocation();
+	trans.SetLocation(meta_data.bloom_filter_offset);
+	bool excludes = false;
+	duckdb_parquet::format::BloomFilterHeader header;
+	reader.Read(header, file_proto);
+	// the size comes from the file, so it has to fit in the file (and in the bloom filter, if its length is known)
+	auto max_size = MinValue<idx_t>(ParquetBloomFilter::MAX_SIZE, trans.GetSize() - trans.GetLocation());
+	if (meta_data.__isset.bloom_filter_length) {
+		auto header_size = trans.GetLocation() - idx_t(meta_data.bloom_filter_offset);
+		auto length = idx_t(MaxValue<int32_t>(meta_data.bloom_filter_length, 0));
+		max_size = MinValue<idx_t>(max_size, length < header_size ? 0 : length - header_size);
+	}
+	if (header.algorithm.__isset.BLOCK && header.hash.__isset.XXHASH && header.compression.__isset.UNCOMPRESSED &&
+	    header.numBytes > 0 && idx_t(header.numBytes) <= max_size &&
+	    header.numBytes % ParquetBloomFilter::BLOCK_SIZE == 0) {
+		ParquetBloomFilter bloom_filter(header.numBytes);
+		reader.ReadData(file_proto, bloom_filter.GetData(), header.numBytes);
+		excludes = ParquetStatisticsUtils::BloomFilterExcludes(*this, bloom_filter, filter);
+	}
+	trans.SetLocation(location);
+	return excludes;
+}
+
+void ColumnReader::SetDictionaryFilter(optional_ptr<TableFilter> filter) {
+	dictionary_filter = filter;
+	dictionary_selection.clear();
+}
+
+static bool IsDictionaryEncoded(const duckdb_parquet::format::ColumnMetaData &meta_data) {
+	if (meta_data.__isset.encoding_stats && !meta_data.encoding_stats.empty()) {
+		for (auto &encoding_stats : meta_data.encoding_stats) {
+			if (encoding_stats.page_type != PageType::DATA_PAGE && encoding_stats.page_type != PageType::DATA_PAGE_V2) {
+				continue;
+			}
+			if (encoding_stats.count > 0 && encoding_stats.encoding != Encoding::PLAIN_DICTIONARY &&
+			    encoding_stats.encoding != Encoding::RLE_DICTIONARY) {
+				return false;
+			}
+		}
+		return true;
+	}
+	// without the page encoding stats, the writer only falls back to plain pages if it lists other encodings
+	bool has_dictionary = false;
+	for (auto &encoding : meta_data.encodings) {
+		if (encoding == Encoding::PLAIN_DICTIONARY) {
+			has_dictionary = true;
+		} else if (encoding != Encoding::RLE && encoding != Encoding::BIT_PACKED) {
+			return false;
+		}
+	}
+	return has_dictionary;
+}
+
+bool ColumnReader::DictionaryFilterExcludes() {
+	if (!dictionary_filter || type.IsNested() || !chunk || !IsDictionaryEncoded(chunk->meta_data)) {
+		return false;
+	}
+	// read the dictionary page up front
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.SetLocation(chunk_read_offset);
+	PrepareRead(none_filter);
+	chunk_read_offset = trans.GetLocation();
+	if (dictionary_selection.empty() || dictionary_null_passes) {
+		return false;
+	}
+	for (auto entry_passes : dictionary_selection) {
+		if (entry_passes) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void ColumnReader::EvaluateDictionaryFilter(idx_t num_entries) {
+	dictionary_selection.clear();
+	if (!dictionary_filter || type.IsNested()) {
+		return;
+	}
+	// the NULL values are not part of the dictionary
+	Value null_value(type);
+	Vector null_vector(null_value);
+	parquet_filter_t null_mask;
+	null_mask.set(0);
+	ParquetReader::ApplyFilter(null_vector, *dictionary_filter, null_mask, 1);
+	dictionary_null_passes = null_mask[0];
+
+	// read the dictionary entries in vectors through the regular dictionary read path
+	dictionary_selection.resize(num_entries, false);
+	Vector entries(type);
+	DictReference(entries);
+	auto entry_offsets = make_unsafe_uniq_array<uint32_t>(STANDARD_VECTOR_SIZE);
+	auto entry_defines = make_unsafe_uniq_array<uint8_t>(STANDARD_VECTOR_SIZE);
+	memset(entry_defines.get(), uint8_t(max_define), STANDARD_VECTOR_SIZE);
+	for (idx_t entry_idx = 0; entry_idx < num_entries; entry_idx += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, num_entries - entry_idx);
+		parquet_filter_t entry_mask;
+		for (idx_t i = 0; i < count; i++) {
+			entry_offsets[i] = uint32_t(entry_idx + i);
+			entry_mask.set(i);
+		}
+		Offsets(entry_offsets.get(), entry_defines.get(), count, entry_mask, 0, entries);
+		ParquetReader::ApplyFilter(entries, *dictionary_filter, entry_mask, count);
+		for (idx_t i = 0; i < count; i++) {
+			dictionary_selection[entry_idx + i] = entry_mask[i];
+		}
+	}
+}
+
+void ColumnReader::ApplyDictionaryFilter(const uint32_t *offsets, const uint8_t *defines, idx_t num_values,
+                                         parquet_filter_t &filter, idx_t result_offset) {
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = result_offset; row_idx < result_offset + num_values; row_idx++) {
+		bool row_passes;
+		if (HasDefines() && defines[row_idx] != max_define) {
+			row_passes = dictionary_null_passes;
+		} else {
+			auto offset = offsets[offset_idx++];
+			if (offset >= dictionary_selection.size()) {
+				throw std::runtime_error("Parquet file is likely corrupted, dictionary offset out of range");
+			}
+			row_passes = dictionary_selection[offset];
+		}
+		if (!row_passes) {
+			filter.reset(row_idx);
+		}
+	}
+}
+
 void ColumnReader::Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, idx_t num_values, // NOLINT
                          parquet_filter_t &filter, idx_t result_offset, Vector &result) {
 	throw NotImplementedException("Plain");
@@ -233,6 +412,11 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	// the previous row group can end in skipped rows, which are never read
+	page_rows_available = 0;
+	pending_skips = 0;
+	offset_index.reset();
+	dictionary_selection.clear();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -255,6 +439,7 @@ void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 	case PageType::DICTIONARY_PAGE:
 		PreparePage(page_hdr);
 		Dictionary(std::move(block), page_hdr.dictionary_page_header.num_values);
+		EvaluateDictionaryFilter(page_hdr.dictionary_page_header.num_values);
 		break;
 	default:
 		break; // ignore INDEX page type and any other custom extensions
@@ -466,6 +651,7 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 
 	idx_t result_offset = 0;
 	auto to_read = num_values;
+	dictionary_filter_applied = dictionary_filter != nullptr;
 
 	while (to_read > 0) {
 		while (page_rows_available == 0) {
@@ -498,12 +684,22 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 			}
 		}
 
+		if (!dict_decoder) {
+			// the rows of pages that are not dictionary encoded still have to be filtered
+			dictionary_filter_applied = false;
+		}
 		if (dict_decoder) {
 			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
 			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
+			auto offsets = reinterpret_cast<uint32_t *>(offset_buffer.ptr);
+			if (dictionary_selection.empty()) {
+				dictionary_filter_applied = false;
+			} else {
+				// filter on the dictionary indexes, so the values of the rows that do not pass are never read
+				ApplyDictionaryFilter(offsets, define_out, read_now, filter, result_offset);
+			}
 			DictReference(result);
-			Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now, filter, result_offset,
-			        result);
+			Offsets(offsets, define_out, read_now, filter, result_offset, result);
 		} else if (dbp_decoder) {
 			// TODO keep this in the state
 			auto read_buf = make_shared<ResizeableBuffer>();
@@ -571,9 +767,55 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	auto index = GetOffsetIndex();
+	if (!index || index->page_locations.empty()) {
+		return num_values;
+	}
+	// without repeats every value is a row, find the last page that starts at or before the row we skip to
+	auto &pages = index->page_locations;
+	const auto row = idx_t(chunk->meta_data.num_values) - group_rows_available;
+	const auto target_row = row + num_values;
+	auto entry = std::upper_bound(
+	    pages.begin(), pages.end(), target_row,
+	    [](idx_t target, const PageLocation &page) { return target < idx_t(page.first_row_index); });
+	if (entry == pages.begin()) {
+		return num_values;
+	}
+	--entry;
+	if (idx_t(entry->first_row_index) <= row + page_rows_available) {
+		// the row is in the current (or the next) page
+		return num_values;
+	}
+
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	if (row == 0 && page_rows_available == 0 && chunk->meta_data.__isset.dictionary_page_offset &&
+	    chunk->meta_data.dictionary_page_offset >= 4) {
+		// we have not read the dictionary page yet
+		trans.SetLocation(chunk_read_offset);
+		PrepareRead(none_filter);
+		chunk_read_offset = trans.GetLocation();
+		if (idx_t(entry->first_row_index) <= row + page_rows_available) {
+			return num_values;
+		}
+	}
+	// continue reading from the start of the page
+	page_rows_available = 0;
+	chunk_read_offset = entry->offset;
+	trans.SetLocation(chunk_read_offset);
+	group_rows_available -= entry->first_row_index - row;
+	return target_row - entry->first_row_index;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	// pages that only contain skipped values are not read at all
+	num_values = SkipPages(num_values);
+	if (num_values == 0) {
+		return;
+	}
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
@@ -982,6 +1224,10 @@ unique_ptr<BaseStatistics> CastColumnReader::Stats(idx_t row_group_idx_p, const
 	return nullptr;
 }
 
+unique_ptr<BaseStatistics> CastColumnReader::PageStats(const ColumnIndex &column_index, idx_t page_idx) {
+	return nullptr;
+}
+
 void CastColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns,
                                       TProtocol &protocol_p) {
 	child_reader->InitializeRead(row_group_idx_p, columns, protocol_p);
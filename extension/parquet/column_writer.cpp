@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_dbp_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -42,7 +43,7 @@ using duckdb_parquet::format::Type;
 
 #define PARQUET_DEFINE_VALID 65535
 
-static void VarintEncode(uint32_t val, WriteStream &ser) {
+static void VarintEncode(uint64_t val, WriteStream &ser) {
 	do {
 		uint8_t byte = val & 127;
 		val >>= 7;
@@ -53,7 +54,7 @@ static void VarintEncode(uint32_t val, WriteStream &ser) {
 	} while (val != 0);
 }
 
-static uint8_t GetVarintSize(uint32_t val) {
+static uint8_t GetVarintSize(uint64_t val) {
 	uint8_t res = 0;
 	do {
 		val >>= 7;
@@ -84,6 +85,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -170,6 +174,126 @@ void RleBpEncoder::FinishWrite(WriteStream &writer) {
 	WriteRun(writer);
 }
 
+//===--------------------------------------------------------------------===//
+// DbpEncoder
+//===--------------------------------------------------------------------===//
+DbpEncoder::DbpEncoder(idx_t value_width)
+    : value_width(value_width), value_count(0), first_value(0), previous_value(0), delta_count(0), byte_count(0) {
+	D_ASSERT(value_width == 32 || value_width == 64);
+}
+
+static uint64_t ZigzagEncode(int64_t value) {
+	return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+}
+
+void DbpEncoder::AddValue(int64_t value) {
+	if (value_width == 32) {
+		value = int32_t(value);
+	}
+	if (value_count++ == 0) {
+		first_value = value;
+		previous_value = value;
+		return;
+	}
+	// the deltas wrap around at the width of the type, so they always fit in it
+	auto delta = uint64_t(value) - uint64_t(previous_value);
+	deltas[delta_count++] = value_width == 32 ? int64_t(int32_t(uint32_t(delta))) : int64_t(delta);
+	previous_value = value;
+}
+
+void DbpEncoder::FinishBlock(bool write) {
+	if (delta_count == 0) {
+		return;
+	}
+	int64_t min_delta = deltas[0];
+	for (idx_t i = 1; i < delta_count; i++) {
+		min_delta = MinValue(min_delta, deltas[i]);
+	}
+	// the bit widths of the miniblocks, unused miniblocks have width 0 and no data
+	uint8_t bit_widths[MINIBLOCKS_PER_BLOCK];
+	for (idx_t miniblock_idx = 0; miniblock_idx < MINIBLOCKS_PER_BLOCK; miniblock_idx++) {
+		uint64_t max_value = 0;
+		for (idx_t i = miniblock_idx * MINIBLOCK_SIZE; i < MinValue((miniblock_idx + 1) * MINIBLOCK_SIZE, delta_count);
+		     i++) {
+			max_value = MaxValue(max_value, uint64_t(deltas[i]) - uint64_t(min_delta));
+		}
+		uint8_t bit_width = 0;
+		while (bit_width < 64 && (max_value >> bit_width) != 0) {
+			bit_width++;
+		}
+		bit_widths[miniblock_idx] = bit_width;
+		// the last miniblock is padded to the full miniblock size
+		byte_count += MINIBLOCK_SIZE * bit_width / 8;
+	}
+	byte_count += GetVarintSize(ZigzagEncode(min_delta)) + MINIBLOCKS_PER_BLOCK;
+	if (write) {
+		VarintEncode(ZigzagEncode(min_delta), blocks);
+		blocks.WriteData(bit_widths, MINIBLOCKS_PER_BLOCK);
+		for (idx_t miniblock_idx = 0; miniblock_idx * MINIBLOCK_SIZE < delta_count; miniblock_idx++) {
+			auto bit_width = bit_widths[miniblock_idx];
+			// bit-pack the values of the miniblock, least significant bits first
+			uint64_t buffer = 0;
+			idx_t buffer_bits = 0;
+			for (idx_t i = miniblock_idx * MINIBLOCK_SIZE; i < (miniblock_idx + 1) * MINIBLOCK_SIZE; i++) {
+				uint64_t value = i < delta_count ? uint64_t(deltas[i]) - uint64_t(min_delta) : 0;
+				idx_t remaining_bits = bit_width;
+				while (remaining_bits > 0) {
+					auto bits = MinValue<idx_t>(remaining_bits, 64 - buffer_bits);
+					auto mask = bits == 64 ? NumericLimits<uint64_t>::Maximum() : (uint64_t(1) << bits) - 1;
+					buffer |= (value & mask) << buffer_bits;
+					value = bits == 64 ? 0 : value >> bits;
+					buffer_bits += bits;
+					remaining_bits -= bits;
+					while (buffer_bits >= 8) {
+						blocks.Write<uint8_t>(uint8_t(buffer & 0xFF));
+						buffer >>= 8;
+						buffer_bits -= 8;
+					}
+				}
+			}
+			D_ASSERT(buffer_bits == 0);
+		}
+	}
+	delta_count = 0;
+}
+
+idx_t DbpEncoder::HeaderSize() {
+	return GetVarintSize(BLOCK_SIZE) + GetVarintSize(MINIBLOCKS_PER_BLOCK) + GetVarintSize(value_count) +
+	       GetVarintSize(ZigzagEncode(first_value));
+}
+
+void DbpEncoder::PrepareValue(int64_t value) {
+	AddValue(value);
+	if (delta_count == BLOCK_SIZE) {
+		FinishBlock(false);
+	}
+}
+
+void DbpEncoder::FinishPrepare() {
+	FinishBlock(false);
+}
+
+idx_t DbpEncoder::GetByteCount() {
+	return HeaderSize() + byte_count;
+}
+
+void DbpEncoder::WriteValue(int64_t value) {
+	AddValue(value);
+	if (delta_count == BLOCK_SIZE) {
+		FinishBlock(true);
+	}
+}
+
+void DbpEncoder::FinishWrite(WriteStream &writer) {
+	FinishBlock(true);
+	// <block size in values> <number of miniblocks in a block> <total value count> <first value>
+	VarintEncode(BLOCK_SIZE, writer);
+	VarintEncode(MINIBLOCKS_PER_BLOCK, writer);
+	VarintEncode(value_count, writer);
+	VarintEncode(ZigzagEncode(first_value), writer);
+	writer.WriteData(blocks.GetData(), blocks.GetPosition());
+}
+
 //===--------------------------------------------------------------------===//
 // ColumnWriter
 //===--------------------------------------------------------------------===//
@@ -306,6 +430,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page, only tracked when writing the page index
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -327,6 +453,8 @@ public:
 	vector<PageInformation> page_info;
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
+	//! The bloom filter of the column chunk (if any)
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 	idx_t current_page = 0;
 };
 
@@ -354,6 +482,11 @@ public:
 	static constexpr const idx_t MAX_DICTIONARY_KEY_SIZE = sizeof(uint32_t);
 	// the size of encoding the string length
 	static constexpr const idx_t STRING_LENGTH_SIZE = sizeof(uint32_t);
+	//! With a page index we also limit the rows per page, so that readers can skip individual pages
+	static constexpr const idx_t PAGE_INDEX_MAX_PAGE_ROWS = 10 * STANDARD_VECTOR_SIZE;
+	//! With PARQUET_ENCODING auto, a delta encoding is only chosen if its estimated size is below this ratio of the
+	//! plain size, as the delta encodings are slower to decode
+	static constexpr const double MAX_ENCODED_SIZE_RATIO = 0.75;
 
 public:
 	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override;
@@ -396,8 +529,34 @@ protected:
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+
+	//! Whether the values of the column can be hashed into a bloom filter
+	virtual bool HasBloomFilter() {
+		return false;
+	}
+	//! An upper bound of the number of distinct values the bloom filter of the column chunk has to hold
+	virtual idx_t BloomFilterEntries(BasicColumnWriterState &state);
+	//! Insert the hashes of the (valid) values of the vector into the bloom filter
+	virtual void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t count);
+
+	//! Whether we write the page index for this column (only for columns without repeats, where pages start at rows)
+	bool WritesPageIndex() const;
+	//! Create the column index of the pages, or nullptr if not all pages have statistics
+	unique_ptr<duckdb_parquet::format::ColumnIndex> CreateColumnIndex(BasicColumnWriterState &state);
 };
 
+bool BasicColumnWriter::WritesPageIndex() const {
+	return writer.WritePageIndex() && max_repeat == 0;
+}
+
+idx_t BasicColumnWriter::BloomFilterEntries(BasicColumnWriterState &state) {
+	return state.row_group.columns[state.col_idx].meta_data.num_values;
+}
+
+void BasicColumnWriter::UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t count) {
+	throw InternalException("UpdateBloomFilter unsupported for this column writer");
+}
+
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) {
 	auto result = make_uniq<BasicColumnWriterState>(row_group, row_group.columns.size());
 	RegisterToRowGroup(row_group);
@@ -432,8 +591,14 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	HandleRepeatLevels(state, parent, count, max_repeat);
 	HandleDefineLevels(state, parent, validity, count, max_define, max_define - 1);
 
+	const auto max_page_rows = WritesPageIndex() ? PAGE_INDEX_MAX_PAGE_ROWS : NumericLimits<idx_t>::Maximum();
 	idx_t vector_index = 0;
 	for (idx_t i = start; i < vcount; i++) {
+		if (state.page_info.back().row_count >= max_page_rows) {
+			PageInformation new_info;
+			new_info.offset = state.page_info.back().offset + state.page_info.back().row_count;
+			state.page_info.push_back(new_info);
+		}
 		auto &page_info = state.page_info.back();
 		page_info.row_count++;
 		col_chunk.meta_data.num_values++;
@@ -462,6 +627,11 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (writer.WriteBloomFilter() && HasBloomFilter()) {
+		auto num_bytes =
+		    ParquetBloomFilter::OptimalSize(BloomFilterEntries(state), writer.BloomFilterFalsePositiveRatio());
+		state.bloom_filter = make_uniq<ParquetBloomFilter>(num_bytes);
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -486,6 +656,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		if (WritesPageIndex()) {
+			write_info.page_stats = InitializeStatsState();
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -556,6 +729,9 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	if (write_info.page_stats) {
+		state.stats_state->Merge(*write_info.page_stats);
+	}
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -587,6 +763,9 @@ idx_t BasicColumnWriter::GetRowSize(Vector &vector, idx_t index, BasicColumnWrit
 
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
+	if (state.bloom_filter) {
+		UpdateBloomFilter(state, vector, count);
+	}
 
 	idx_t remaining = count;
 	idx_t offset = 0;
@@ -599,8 +778,8 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -652,6 +831,27 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 	for (const auto &write_info : state.write_info) {
 		column_chunk.meta_data.encodings.push_back(write_info.page_header.data_page_header.encoding);
 	}
+	// the page encoding stats tell readers whether all data pages are dictionary encoded
+	auto &encoding_stats = column_chunk.meta_data.encoding_stats;
+	for (const auto &write_info : state.write_info) {
+		auto &page_header = write_info.page_header;
+		auto encoding = page_header.type == PageType::DICTIONARY_PAGE ? page_header.dictionary_page_header.encoding
+		                                                              : page_header.data_page_header.encoding;
+		auto entry = std::find_if(encoding_stats.begin(), encoding_stats.end(),
+		                          [&](const duckdb_parquet::format::PageEncodingStats &stats) {
+			                          return stats.page_type == page_header.type && stats.encoding == encoding;
+		                          });
+		if (entry == encoding_stats.end()) {
+			duckdb_parquet::format::PageEncodingStats stats;
+			stats.page_type = page_header.type;
+			stats.encoding = encoding;
+			stats.count = 0;
+			encoding_stats.push_back(stats);
+			entry = encoding_stats.end() - 1;
+		}
+		entry->count++;
+	}
+	column_chunk.meta_data.__isset.encoding_stats = true;
 }
 
 void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
@@ -663,23 +863,20 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	auto &column_writer = writer.GetWriter();
 	auto start_offset = column_writer.GetTotalWritten();
-	auto page_offset = start_offset;
 	// flush the dictionary
 	if (HasDictionary(state)) {
 		column_chunk.meta_data.statistics.distinct_count = DictionarySize(state);
 		column_chunk.meta_data.statistics.__isset.distinct_count = true;
-		column_chunk.meta_data.dictionary_page_offset = page_offset;
+		column_chunk.meta_data.dictionary_page_offset = start_offset;
 		column_chunk.meta_data.__isset.dictionary_page_offset = true;
 		FlushDictionary(state, state.stats_state.get());
-		page_offset += state.write_info[0].compressed_size;
 	}
 
-	// record the start position of the pages for this column
-	column_chunk.meta_data.data_page_offset = page_offset;
 	SetParquetStatistics(state, column_chunk);
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	duckdb_parquet::format::OffsetIndex offset_index;
 	for (auto &write_info : state.write_info) {
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
 		auto header_start_offset = column_writer.GetTotalWritten();
@@ -688,9 +885,70 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+
+		if (write_info.page_header.type == PageType::DATA_PAGE) {
+			if (offset_index.page_locations.empty()) {
+				// record the start position of the data pages (after the header of the dictionary page and its data)
+				column_chunk.meta_data.data_page_offset = int64_t(header_start_offset);
+			}
+			// the data pages are in the same order as the page info
+			duckdb_parquet::format::PageLocation page_location;
+			page_location.offset = header_start_offset;
+			page_location.compressed_page_size = column_writer.GetTotalWritten() - header_start_offset;
+			page_location.first_row_index = state.page_info[offset_index.page_locations.size()].offset;
+			offset_index.page_locations.push_back(page_location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	if (WritesPageIndex()) {
+		writer.AddPageIndex(state.col_idx, CreateColumnIndex(state), std::move(offset_index));
+	}
+	if (state.bloom_filter) {
+		// the filter was sized for an upper bound of the distinct count - shrink it to the size for the estimated count
+		auto &bloom_filter = *state.bloom_filter;
+		bloom_filter.Shrink(
+		    ParquetBloomFilter::OptimalSize(bloom_filter.EstimateEntries(), writer.BloomFilterFalsePositiveRatio()));
+		writer.AddBloomFilter(state.col_idx, std::move(state.bloom_filter));
+	}
+}
+
+unique_ptr<duckdb_parquet::format::ColumnIndex> BasicColumnWriter::CreateColumnIndex(BasicColumnWriterState &state) {
+	auto column_index = make_uniq<duckdb_parquet::format::ColumnIndex>();
+	column_index->boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	idx_t page_idx = 0;
+	for (auto &write_info : state.write_info) {
+		if (write_info.page_header.type != PageType::DATA_PAGE) {
+			continue;
+		}
+		D_ASSERT(write_info.page_stats);
+		auto &page_info = state.page_info[page_idx++];
+		// without repeats, every definition level is a row
+		idx_t page_null_count = 0;
+		if (!state.definition_levels.empty()) {
+			for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+				page_null_count += state.definition_levels[i] < max_define;
+			}
+		}
+		const bool null_page = page_null_count == page_info.row_count;
+		string min_value;
+		string max_value;
+		if (!null_page) {
+			min_value = write_info.page_stats->GetMinValue();
+			max_value = write_info.page_stats->GetMaxValue();
+			if (min_value.empty() || max_value.empty()) {
+				// the type has no statistics (or the values are too large)
+				return nullptr;
+			}
+		}
+		column_index->null_pages.push_back(null_page);
+		column_index->min_values.push_back(std::move(min_value));
+		column_index->max_values.push_back(std::move(max_value));
+		column_index->null_counts.push_back(int64_t(page_null_count));
+	}
+	return column_index;
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -760,6 +1018,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -853,6 +1120,35 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, idx_
 	}
 }
 
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx, idx_t value_width)
+	    : BasicColumnWriterState(row_group, col_idx), encoding(Encoding::PLAIN), dbp_analyzer(value_width) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	//! The encoding of the data pages
+	duckdb_parquet::format::Encoding::type encoding;
+
+	// analysis state
+	idx_t estimated_plain_size = 0;
+	DbpEncoder dbp_analyzer;
+};
+
+template <class T>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	explicit StandardWriterPageState(duckdb_parquet::format::Encoding::type encoding)
+	    : encoding(encoding), dbp_encoder(sizeof(T) * 8) {
+	}
+
+	duckdb_parquet::format::Encoding::type encoding;
+	//! DELTA_BINARY_PACKED pages
+	DbpEncoder dbp_encoder;
+	//! BYTE_STREAM_SPLIT pages, the values are split into their bytes when the page is flushed
+	vector<T> values;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -862,15 +1158,121 @@ public:
 	}
 	~StandardColumnWriter() override = default;
 
+	//! INT32 and INT64 values can be written in the DELTA_BINARY_PACKED encoding
+	static constexpr const bool DELTA_ENCODING = std::is_integral<TGT>::value;
+	//! FLOAT and DOUBLE values can be written in the BYTE_STREAM_SPLIT encoding
+	static constexpr const bool BYTE_STREAM_SPLIT_ENCODING = std::is_floating_point<TGT>::value;
+
 public:
 	unique_ptr<ColumnWriterStatistics> InitializeStatsState() override {
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override {
+		auto result = make_uniq<StandardColumnWriterState>(row_group, row_group.columns.size(), sizeof(TGT) * 8);
+		if (BYTE_STREAM_SPLIT_ENCODING && writer.AutoEncoding() && writer.GetCodec() != CompressionCodec::UNCOMPRESSED) {
+			// splitting the values into their bytes does not make the data smaller, but it compresses much better
+			result->encoding = Encoding::BYTE_STREAM_SPLIT;
+		}
+		RegisterToRowGroup(row_group);
+		return std::move(result);
+	}
+
+	bool HasAnalyze() override {
+		return DELTA_ENCODING && writer.AutoEncoding();
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<SRC>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				state.dbp_analyzer.PrepareValue(int64_t(target_value));
+				state.estimated_plain_size += sizeof(TGT);
+			}
+		}
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		state.dbp_analyzer.FinishPrepare();
+		if (double(state.dbp_analyzer.GetByteCount()) < MAX_ENCODED_SIZE_RATIO * double(state.estimated_plain_size)) {
+			state.encoding = Encoding::DELTA_BINARY_PACKED;
+		}
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		return state.encoding;
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		if (state.encoding == Encoding::PLAIN) {
+			return nullptr;
+		}
+		return make_uniq<StandardWriterPageState<TGT>>(state.encoding);
+	}
+
+	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		if (!page_state_p) {
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			return;
+		}
+		auto &page_state = page_state_p->Cast<StandardWriterPageState<TGT>>();
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+			if (page_state.encoding == Encoding::DELTA_BINARY_PACKED) {
+				page_state.dbp_encoder.WriteValue(int64_t(target_value));
+			} else {
+				page_state.values.push_back(target_value);
+			}
+		}
+	}
+
+	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
+		if (!state_p) {
+			return;
+		}
+		auto &page_state = state_p->Cast<StandardWriterPageState<TGT>>();
+		if (page_state.encoding == Encoding::DELTA_BINARY_PACKED) {
+			page_state.dbp_encoder.FinishWrite(temp_writer);
+			return;
+		}
+		// BYTE_STREAM_SPLIT: the first bytes of all values, followed by the second bytes of all values, etc.
+		auto &values = page_state.values;
+		auto value_data = const_data_ptr_cast(values.data());
+		auto stream = make_unsafe_uniq_array<data_t>(values.size());
+		for (idx_t byte_idx = 0; byte_idx < sizeof(TGT); byte_idx++) {
+			for (idx_t i = 0; i < values.size(); i++) {
+				stream[i] = value_data[i * sizeof(TGT) + byte_idx];
+			}
+			temp_writer.WriteData(stream.get(), values.size());
+		}
+	}
+
+	bool HasBloomFilter() override {
+		return true;
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t count) override {
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<SRC>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				state.bloom_filter->FilterInsert(ParquetBloomFilter::Hash(target_value));
+			}
+		}
 	}
 
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
@@ -906,6 +1308,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1037,6 +1444,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1218,12 +1632,23 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			min = string();
+			max = string();
+		} else if (other.HasStats()) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
 public:
 	StringColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx)
-	    : BasicColumnWriterState(row_group, col_idx) {
+	    : BasicColumnWriterState(row_group, col_idx), prefix_analyzer(32), suffix_analyzer(32) {
 	}
 	~StringColumnWriterState() override = default;
 
@@ -1231,6 +1656,14 @@ public:
 	idx_t estimated_dict_page_size = 0;
 	idx_t estimated_rle_pages_size = 0;
 	idx_t estimated_plain_size = 0;
+	// analysis state of the DELTA_BYTE_ARRAY encoding, only used with PARQUET_ENCODING auto
+	DbpEncoder prefix_analyzer;
+	DbpEncoder suffix_analyzer;
+	idx_t estimated_suffix_size = 0;
+	string_t last_value;
+	bool has_last_value = false;
+	// whether the (non-dictionary) pages are written in the DELTA_BYTE_ARRAY encoding
+	bool delta_encoded = false;
 
 	// Dictionary and accompanying string heap
 	string_map_t<uint32_t> dictionary;
@@ -1244,21 +1677,42 @@ public:
 
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, bool delta_encoded)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false),
+	      delta_encoded(delta_encoded), prefix_encoder(32), suffix_encoder(32) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
+		D_ASSERT(!IsDictionaryEncoded() || !delta_encoded);
 	}
 
 	bool IsDictionaryEncoded() {
 		return bit_width != 0;
 	}
-	// if 0, we're writing a plain page
+	// if 0, we're writing a plain or a delta page
 	uint32_t bit_width;
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+
+	// DELTA_BYTE_ARRAY pages: the prefix lengths, the suffix lengths and the suffixes
+	bool delta_encoded;
+	DbpEncoder prefix_encoder;
+	DbpEncoder suffix_encoder;
+	MemoryStream suffixes;
+	string_t last_value;
 };
 
+//! The length of the common prefix of two strings
+static idx_t CommonPrefixLength(const string_t &left, const string_t &right) {
+	auto left_data = left.GetData();
+	auto right_data = right.GetData();
+	auto max_length = MinValue(left.GetSize(), right.GetSize());
+	idx_t length = 0;
+	while (length < max_length && left_data[length] == right_data[length]) {
+		length++;
+	}
+	return length;
+}
+
 class StringColumnWriter : public BasicColumnWriter {
 public:
 	StringColumnWriter(ParquetWriter &writer, idx_t schema_idx, vector<string> schema_path_p, idx_t max_repeat,
@@ -1318,6 +1772,14 @@ public:
 					run_count++;
 					last_value_index = found.first->second;
 				}
+				if (writer.AutoEncoding()) {
+					auto prefix_length = state.has_last_value ? CommonPrefixLength(state.last_value, value) : 0;
+					state.prefix_analyzer.PrepareValue(int64_t(prefix_length));
+					state.suffix_analyzer.PrepareValue(int64_t(value.GetSize() - prefix_length));
+					state.estimated_suffix_size += value.GetSize() - prefix_length;
+					state.last_value = value;
+					state.has_last_value = true;
+				}
 			}
 			vector_index++;
 		}
@@ -1339,6 +1801,15 @@ public:
 		} else {
 			state.key_bit_width = RleBpDecoder::ComputeBitWidth(state.dictionary.size());
 		}
+		if (!state.IsDictionaryEncoded() && writer.AutoEncoding()) {
+			// the delta encoding pays off if the values share long prefixes, e.g. sorted keys or URLs
+			state.prefix_analyzer.FinishPrepare();
+			state.suffix_analyzer.FinishPrepare();
+			auto estimated_delta_size = state.prefix_analyzer.GetByteCount() + state.suffix_analyzer.GetByteCount() +
+			                            state.estimated_suffix_size;
+			state.delta_encoded =
+			    double(estimated_delta_size) < MAX_ENCODED_SIZE_RATIO * double(state.estimated_plain_size);
+		}
 	}
 
 	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats_p, ColumnWriterPageState *page_state_p,
@@ -1349,11 +1820,15 @@ public:
 
 		auto *ptr = FlatVector::GetData<string_t>(input_column);
 		if (page_state.IsDictionaryEncoded()) {
-			// dictionary based page
+			// dictionary based page, the statistics of the column chunk are computed from the dictionary
+			const bool page_stats = WritesPageIndex();
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
 				if (!mask.RowIsValid(r)) {
 					continue;
 				}
+				if (page_stats) {
+					stats.Update(ptr[r]);
+				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
 				if (!page_state.written_value) {
 					// first value
@@ -1366,6 +1841,23 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
+		} else if (page_state.delta_encoded) {
+			// delta page, every value is stored as the length of the prefix it shares with the previous value and
+			// the remaining suffix
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				auto &value = ptr[r];
+				stats.Update(value);
+				auto prefix_length = page_state.written_value ? CommonPrefixLength(page_state.last_value, value) : 0;
+				page_state.prefix_encoder.WriteValue(int64_t(prefix_length));
+				page_state.suffix_encoder.WriteValue(int64_t(value.GetSize() - prefix_length));
+				page_state.suffixes.WriteData(const_data_ptr_cast(value.GetData()) + prefix_length,
+				                              value.GetSize() - prefix_length);
+				page_state.last_value = value;
+				page_state.written_value = true;
+			}
 		} else {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
@@ -1381,11 +1873,17 @@ public:
 
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, state.delta_encoded);
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
 		auto &page_state = state_p->Cast<StringWriterPageState>();
+		if (page_state.delta_encoded) {
+			page_state.prefix_encoder.FinishWrite(temp_writer);
+			page_state.suffix_encoder.FinishWrite(temp_writer);
+			temp_writer.WriteData(page_state.suffixes.GetData(), page_state.suffixes.GetPosition());
+			return;
+		}
 		if (page_state.bit_width != 0) {
 			if (!page_state.written_value) {
 				// all values are null
@@ -1399,7 +1897,10 @@ public:
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		if (state.IsDictionaryEncoded()) {
+			return Encoding::RLE_DICTIONARY;
+		}
+		return state.delta_encoded ? Encoding::DELTA_BYTE_ARRAY : Encoding::PLAIN;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
@@ -1413,6 +1914,34 @@ public:
 		return state.dictionary.size();
 	}
 
+	bool HasBloomFilter() override {
+		return true;
+	}
+
+	idx_t BloomFilterEntries(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			return state.dictionary.size();
+		}
+		return BasicColumnWriter::BloomFilterEntries(state);
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state_p, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			// the values are inserted when the dictionary is flushed
+			return;
+		}
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<string_t>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				state.bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
+	}
+
 	void FlushDictionary(BasicColumnWriterState &state_p, ColumnWriterStatistics *stats_p) override {
 		auto &stats = stats_p->Cast<StringStatisticsState>();
 		auto &state = state_p.Cast<StringColumnWriterState>();
@@ -1431,6 +1960,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (state.bloom_filter) {
+				state.bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
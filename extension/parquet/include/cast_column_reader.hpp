@@ -26,6 +26,16 @@ public:
 
 public:
 	unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns) override;
+	unique_ptr<BaseStatistics> PageStats(const ColumnIndex &column_index, idx_t page_idx) override;
+	bool BloomFilterExcludes(const vector<ColumnChunk> &columns, TProtocol &file_proto,
+	                         const TableFilter &filter) override {
+		// the filter constants are of the target type
+		return false;
+	}
+	bool DictionaryFilterExcludes() override {
+		// the filter constants are of the target type
+		return false;
+	}
 	void InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) override;
 
 	idx_t Read(uint64_t num_values, parquet_filter_t &filter, data_ptr_t define_out, data_ptr_t repeat_out,
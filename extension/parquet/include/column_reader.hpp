@@ -30,8 +30,10 @@ class ParquetReader;
 using duckdb_apache::thrift::protocol::TProtocol;
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
@@ -69,6 +71,25 @@ public:
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
+	//! The statistics of a single page of the column chunk, from its column index
+	virtual unique_ptr<BaseStatistics> PageStats(const ColumnIndex &column_index, idx_t page_idx);
+
+	//! The offset index of the column chunk, or nullptr if it has none (or it cannot be used to skip pages)
+	const OffsetIndex *GetOffsetIndex();
+	//! Read the column index of the column chunk, returns false if it has none
+	bool ReadColumnIndex(ColumnIndex &column_index);
+	//! Whether the bloom filter of the column chunk guarantees that no value passes the filter
+	virtual bool BloomFilterExcludes(const vector<ColumnChunk> &columns, TProtocol &file_proto,
+	                                 const TableFilter &filter);
+	//! Evaluate the filter once per dictionary entry, and filter the dictionary encoded rows by their index
+	void SetDictionaryFilter(optional_ptr<TableFilter> filter);
+	//! Whether the column chunk is fully dictionary encoded and neither NULL nor any dictionary entry passes the
+	//! dictionary filter, reads the dictionary page of the column chunk
+	virtual bool DictionaryFilterExcludes();
+	//! Whether the dictionary filter was applied to all rows returned by the last Read()
+	bool DictionaryFilterApplied() const {
+		return dictionary_filter_applied;
+	}
 
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
@@ -138,6 +159,12 @@ private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
+	//! Jump over the pages that only contain values to skip, returns the number of values left to skip
+	idx_t SkipPages(idx_t num_values);
+	void ReadPageIndex(duckdb_apache::thrift::TBase &object, int64_t offset);
+	void EvaluateDictionaryFilter(idx_t num_entries);
+	void ApplyDictionaryFilter(const uint32_t *offsets, const uint8_t *defines, idx_t num_values,
+	                           parquet_filter_t &filter, idx_t result_offset);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
@@ -163,6 +190,15 @@ private:
 	unique_ptr<RleBpDecoder> rle_decoder;
 	unique_ptr<BssDecoder> bss_decoder;
 
+	unique_ptr<OffsetIndex> offset_index;
+
+	optional_ptr<TableFilter> dictionary_filter;
+	//! For each entry of the dictionary of the column chunk, whether it passes the dictionary filter
+	vector<bool> dictionary_selection;
+	//! Whether NULL passes the dictionary filter
+	bool dictionary_null_passes = false;
+	bool dictionary_filter_applied = false;
+
 	// dummies for Skip()
 	parquet_filter_t none_filter;
 	ResizeableBuffer dummy_define;
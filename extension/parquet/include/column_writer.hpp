@@ -47,6 +47,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merge the statistics of a page into the statistics of the column chunk
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
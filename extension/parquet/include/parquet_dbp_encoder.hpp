@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "parquet_types.h"
+#include "thrift_tools.hpp"
+#include "resizable_buffer.hpp"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/memory_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the DELTA_BINARY_PACKED encoding
+class DbpEncoder {
+public:
+	//! The value width is the width of the physical type (32 for INT32, 64 for INT64), deltas wrap around at it
+	explicit DbpEncoder(idx_t value_width);
+
+public:
+	//! NOTE: like in the RleBpEncoder, Prepare only computes the byte count of the encoded values
+	void PrepareValue(int64_t value);
+	void FinishPrepare();
+	idx_t GetByteCount();
+
+	//! The blocks are buffered until FinishWrite, as the header that precedes them contains the total value count
+	void WriteValue(int64_t value);
+	void FinishWrite(WriteStream &writer);
+
+	static constexpr const idx_t BLOCK_SIZE = 128;
+	static constexpr const idx_t MINIBLOCKS_PER_BLOCK = 4;
+	static constexpr const idx_t MINIBLOCK_SIZE = BLOCK_SIZE / MINIBLOCKS_PER_BLOCK;
+
+private:
+	//! meta information
+	idx_t value_width;
+	//! the values
+	idx_t value_count;
+	int64_t first_value;
+	int64_t previous_value;
+	//! the deltas of the current block
+	int64_t deltas[BLOCK_SIZE];
+	idx_t delta_count;
+	//! the size of the finished blocks
+	idx_t byte_count;
+	//! the finished blocks (when writing)
+	MemoryStream blocks;
+
+private:
+	void AddValue(int64_t value);
+	//! Finish the current block, writes it to the blocks if write is true
+	void FinishBlock(bool write);
+	idx_t HeaderSize();
+};
+
+} // namespace duckdb
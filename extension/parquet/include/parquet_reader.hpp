@@ -47,6 +47,11 @@ struct ParquetReaderPrefetchConfig {
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
 };
 
+struct ParquetReaderSplitConfig {
+	// Minimum number of rows in each of the ranges a row group is split into, to be scanned by different threads
+	static constexpr idx_t MINIMUM_SPLIT_ROWS = 64 * STANDARD_VECTOR_SIZE;
+};
+
 struct ParquetReaderScanState {
 	vector<idx_t> group_idx_list;
 	int64_t current_group;
@@ -63,6 +68,14 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The row ranges [begin, end) of the current row group that the page index rules out, sorted
+	vector<pair<idx_t, idx_t>> skip_ranges;
+	idx_t skip_range_idx = 0;
+
+	//! The rows [begin, end) of the row group that are scanned, if the row group is split over several threads
+	idx_t split_begin = 0;
+	idx_t split_end = NumericLimits<idx_t>::Maximum();
 };
 
 struct ParquetColumnDefinition {
@@ -121,10 +134,17 @@ public:
 
 public:
 	void InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read);
+	//! Scan only the range "split_idx" out of the "split_count" ranges of rows the row group is split into
+	void InitializeScan(ParquetReaderScanState &state, idx_t group_idx, idx_t split_idx, idx_t split_count);
 	void Scan(ParquetReaderScanState &state, DataChunk &output);
 
 	idx_t NumRows();
 	idx_t NumRowGroups();
+	//! The number of ranges (at most max_splits) that the row group can be split into, with the page index letting
+	//! each range jump to its first page
+	idx_t NumRowGroupSplits(idx_t group_idx, idx_t max_splits);
+	//! Whether the bloom filter of the column in the row group guarantees that no value of it passes the filter
+	bool BloomFilterExcludes(idx_t group_idx, idx_t column_idx, const TableFilter &filter);
 
 	const duckdb_parquet::format::FileMetaData *GetFileMetadata();
 
@@ -134,6 +154,8 @@ public:
 
 	unique_ptr<BaseStatistics> ReadStatistics(const string &name);
 	static LogicalType DeriveLogicalType(const SchemaElement &s_ele, bool binary_as_string);
+	//! Apply the filter to the values of the vector, clearing the bits of the rows that do not pass it
+	static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count);
 
 	FileHandle &GetHandle() {
 		return *file_handle;
@@ -162,6 +184,10 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Set up the filters on the dictionaries of the current row group, skipping it if no dictionary entry passes
+	void PrepareDictionaryFilters(ParquetReaderScanState &state);
+	//! Check the filters against the page index of the current row group, to find the rows that can be skipped
+	void PreparePageSkipRanges(ParquetReaderScanState &state);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -9,18 +9,78 @@
 namespace duckdb {
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::SchemaElement;
 
 struct LogicalType;
 class ColumnReader;
+class ParquetBloomFilter;
+class TableFilter;
 
 struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	static unique_ptr<BaseStatistics> TransformPageStatistics(const ColumnReader &reader,
+	                                                          const ColumnIndex &column_index, idx_t page_idx);
+
+	static unique_ptr<BaseStatistics> TransformStatistics(const ColumnReader &reader,
+	                                                      const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
+
+	//! Whether the bloom filter of a column chunk can be used to evaluate the filter (i.e. it has equality checks)
+	static bool BloomFilterSupported(const TableFilter &filter);
+	//! Whether the bloom filter guarantees that no value of the column chunk passes the filter
+	static bool BloomFilterExcludes(const ColumnReader &reader, const ParquetBloomFilter &bloom_filter,
+	                                const TableFilter &filter);
+};
+
+//! A split block bloom filter (SBBF) as specified by Parquet. The filter consists of 256-bit blocks, a value sets one
+//! bit in each of the eight 32-bit words of the block that its (XXH64) hash selects.
+class ParquetBloomFilter {
+public:
+	//! Create an empty filter of the given size in bytes (a power of two multiple of BLOCK_SIZE)
+	explicit ParquetBloomFilter(idx_t num_bytes);
+
+public:
+	void FilterInsert(uint64_t hash);
+	bool FilterCheck(uint64_t hash) const;
+
+	data_ptr_t GetData() {
+		return data_ptr_cast(bits.data());
+	}
+	idx_t GetSize() const {
+		return bits.size() * sizeof(uint32_t);
+	}
+
+	//! Estimate the number of distinct values inserted into the filter from the fraction of bits that are set
+	idx_t EstimateEntries() const;
+	//! Shrink the filter to the given size (a power of two multiple of BLOCK_SIZE) by folding pairs of adjacent
+	//! blocks, which results in exactly the filter of that size
+	void Shrink(idx_t num_bytes);
+
+	//! The filter size in bytes for the given number of distinct values and false positive ratio
+	static idx_t OptimalSize(idx_t num_entries, double false_positive_ratio);
+
+	//! Hash (the plain encoding of) a value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	template <class T>
+	static uint64_t Hash(const T &value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+
+	static constexpr const idx_t BLOCK_WORDS = 8;
+	static constexpr const idx_t BLOCK_SIZE = BLOCK_WORDS * sizeof(uint32_t);
+	//! The maximum size of a filter we write (the default of parquet-mr)
+	static constexpr const idx_t MAX_WRITE_SIZE = 1024 * 1024;
+	//! The maximum size of a filter we read
+	static constexpr const idx_t MAX_SIZE = 128 * 1024 * 1024;
+
+private:
+	idx_t block_count;
+	vector<uint32_t> bits;
 };
 
 } // namespace duckdb
@@ -19,6 +19,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_statistics.hpp"
 #include "parquet_types.h"
 #include "thrift/protocol/TCompactProtocol.h"
 
@@ -36,6 +37,21 @@ struct PreparedRowGroup {
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page index (column index and offset index) of a single column chunk
+struct ParquetPageIndex {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	//! The column index, if all pages have statistics
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	duckdb_parquet::format::OffsetIndex offset_index;
+};
+
+//! The bloom filter of a single column chunk
+struct ParquetBloomFilterEntry {
+	idx_t column_idx;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -64,7 +80,8 @@ public:
 	ParquetWriter(FileSystem &fs, string file_name, vector<LogicalType> types, vector<string> names,
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
-	              shared_ptr<ParquetEncryptionConfig> encryption_config);
+	              shared_ptr<ParquetEncryptionConfig> encryption_config, bool write_page_index,
+	              bool write_bloom_filter, double bloom_filter_false_positive_ratio, bool auto_encoding);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -87,6 +104,24 @@ public:
 	BufferedFileWriter &GetWriter() {
 		return *writer;
 	}
+	bool WritePageIndex() const {
+		return write_page_index;
+	}
+	//! Add the page index of a column chunk of the row group that is being flushed
+	void AddPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                  duckdb_parquet::format::OffsetIndex offset_index);
+	bool WriteBloomFilter() const {
+		return write_bloom_filter;
+	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
+	//! Add the bloom filter of a column chunk of the row group that is being flushed
+	void AddBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter);
+	//! Whether the column writers choose the (delta or byte stream split) encoding of each column chunk
+	bool AutoEncoding() const {
+		return auto_encoding;
+	}
 	idx_t FileSize() {
 		lock_guard<mutex> glock(lock);
 		return writer->total_written;
@@ -106,6 +141,10 @@ private:
 	duckdb_parquet::format::CompressionCodec::type codec;
 	ChildFieldIDs field_ids;
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
+	bool write_page_index;
+	bool write_bloom_filter;
+	double bloom_filter_false_positive_ratio;
+	bool auto_encoding;
 
 	unique_ptr<BufferedFileWriter> writer;
 	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -113,6 +152,14 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	//! The page indexes of the column chunks, written before the footer
+	vector<ParquetPageIndex> page_indexes;
+	//! The bloom filters of the column chunks of the row group that is being flushed, written after its column chunks
+	vector<ParquetBloomFilterEntry> bloom_filters;
+
+private:
+	void WritePageIndexes();
+	void WriteBloomFilters(duckdb_parquet::format::RowGroup &row_group);
 };
 
 } // namespace duckdb
@@ -30,6 +30,13 @@ public:
 	           Vector &result) override;
 
 	unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns) override;
+	bool BloomFilterExcludes(const vector<ColumnChunk> &columns, TProtocol &file_proto,
+	                         const TableFilter &filter) override {
+		return false;
+	}
+	bool DictionaryFilterExcludes() override {
+		return false;
+	}
 
 	void InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) override;
 
@@ -99,6 +99,9 @@ struct ParquetReadGlobalState : public GlobalTableFunctionState {
 	idx_t file_index;
 	//! Index of row group within file currently up for scanning
 	idx_t row_group_index;
+	//! Index of the range of the row group currently up for scanning, and the number of ranges it is split into
+	idx_t row_group_split;
+	idx_t row_group_split_count;
 	//! Batch index of the next row group to be scanned
 	idx_t batch_index;
 
@@ -131,6 +134,14 @@ struct ParquetWriteBindData : public TableFunctionData {
 	//! How/Whether to encrypt the data
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 
+	//! Whether to write the page index (column index and offset index), so readers can skip pages
+	bool write_page_index = false;
+	//! Whether to write bloom filters, so readers can skip row groups on equality filters
+	bool write_bloom_filter = false;
+	double bloom_filter_false_positive_ratio = 0.01;
+	//! Whether to choose the encoding of each column chunk (PARQUET_ENCODING auto), instead of plain or dictionary
+	bool auto_encoding = false;
+
 	ChildFieldIDs field_ids;
 };
 
@@ -550,6 +561,8 @@ public:
 		result->column_ids = input.column_ids;
 		result->filters = input.filters.get();
 		result->row_group_index = 0;
+		result->row_group_split = 0;
+		result->row_group_split_count = 1;
 		result->file_index = 0;
 		result->batch_index = 0;
 		result->max_threads = ParquetScanMaxThreads(context, input.bind_data.get());
@@ -628,7 +641,20 @@ public:
 
 	static idx_t ParquetScanMaxThreads(ClientContext &context, const FunctionData *bind_data) {
 		auto &data = bind_data->Cast<ParquetReadBindData>();
-		return std::max(data.initial_file_row_groups, idx_t(1)) * data.files.size();
+		// large row groups can be split into ranges that are scanned by different threads
+		auto max_splits = data.initial_file_cardinality / ParquetReaderSplitConfig::MINIMUM_SPLIT_ROWS;
+		return std::max(std::max(data.initial_file_row_groups, max_splits), idx_t(1)) * data.files.size();
+	}
+
+	//! The number of ranges to split the next row group into, so that files with fewer row groups than threads still
+	//! keep every thread busy
+	static idx_t ParquetScanRowGroupSplits(ClientContext &context, ParquetReader &reader, idx_t row_group_index) {
+		const auto num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
+		const auto num_row_groups = reader.NumRowGroups();
+		if (num_row_groups >= num_threads) {
+			return 1;
+		}
+		return reader.NumRowGroupSplits(row_group_index, (num_threads + num_row_groups - 1) / num_row_groups);
 	}
 
 	// This function looks for the next available row group. If not available, it will open files from bind_data.files
@@ -653,11 +679,19 @@ public:
 				    parallel_state.readers[parallel_state.file_index]->NumRowGroups()) {
 					// The current reader has rowgroups left to be scanned
 					scan_data.reader = parallel_state.readers[parallel_state.file_index];
-					vector<idx_t> group_indexes {parallel_state.row_group_index};
-					scan_data.reader->InitializeScan(scan_data.scan_state, group_indexes);
+					if (parallel_state.row_group_split == 0) {
+						parallel_state.row_group_split_count =
+						    ParquetScanRowGroupSplits(context, *scan_data.reader, parallel_state.row_group_index);
+					}
+					scan_data.reader->InitializeScan(scan_data.scan_state, parallel_state.row_group_index,
+					                                 parallel_state.row_group_split,
+					                                 parallel_state.row_group_split_count);
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
-					parallel_state.row_group_index++;
+					if (++parallel_state.row_group_split == parallel_state.row_group_split_count) {
+						parallel_state.row_group_split = 0;
+						parallel_state.row_group_index++;
+					}
 					return true;
 				} else {
 					// Close current file
@@ -980,10 +1014,35 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "encryption_config") {
 			bind_data->encryption_config = ParquetEncryptionConfig::Create(context, option.second[0]);
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index = BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (loption == "write_bloom_filter") {
+			bind_data->write_bloom_filter = BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto ratio = DoubleValue::Get(option.second[0].DefaultCastAs(LogicalType::DOUBLE));
+			if (!(ratio > 0 && ratio < 1)) {
+				throw BinderException("BLOOM_FILTER_FALSE_POSITIVE_RATIO must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_false_positive_ratio = ratio;
+		} else if (loption == "parquet_encoding") {
+			const auto roption = StringUtil::Lower(option.second[0].ToString());
+			if (roption == "auto") {
+				bind_data->auto_encoding = true;
+			} else if (roption == "plain") {
+				bind_data->auto_encoding = false;
+			} else {
+				throw BinderException("Expected %s argument to be either [auto or plain]", loption);
+			}
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->write_page_index && bind_data->encryption_config) {
+		throw BinderException("WRITE_PAGE_INDEX is not supported in combination with ENCRYPTION_CONFIG");
+	}
+	if (bind_data->write_bloom_filter && bind_data->encryption_config) {
+		throw BinderException("WRITE_BLOOM_FILTER is not supported in combination with ENCRYPTION_CONFIG");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1007,7 +1066,10 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	auto &fs = FileSystem::GetFileSystem(context);
 	global_state->writer = make_uniq<ParquetWriter>(fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                                                parquet_bind.codec, parquet_bind.field_ids.Copy(),
-	                                                parquet_bind.kv_metadata, parquet_bind.encryption_config);
+	                                                parquet_bind.kv_metadata, parquet_bind.encryption_config,
+	                                                parquet_bind.write_page_index, parquet_bind.write_bloom_filter,
+	                                                parquet_bind.bloom_filter_false_positive_ratio,
+	                                                parquet_bind.auto_encoding);
 	return std::move(global_state);
 }
 
@@ -1120,6 +1182,11 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WriteProperty(106, "field_ids", bind_data.field_ids);
 	serializer.WritePropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(107, "encryption_config",
 	                                                                         bind_data.encryption_config, nullptr);
+	serializer.WritePropertyWithDefault<bool>(108, "write_page_index", bind_data.write_page_index, false);
+	serializer.WritePropertyWithDefault<bool>(109, "write_bloom_filter", bind_data.write_bloom_filter, false);
+	serializer.WritePropertyWithDefault<double>(110, "bloom_filter_false_positive_ratio",
+	                                            bind_data.bloom_filter_false_positive_ratio, 0.01);
+	serializer.WritePropertyWithDefault<bool>(111, "auto_encoding", bind_data.auto_encoding, false);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1133,6 +1200,11 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->field_ids = deserializer.ReadProperty<ChildFieldIDs>(106, "field_ids");
 	deserializer.ReadPropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(107, "encryption_config",
 	                                                                          data->encryption_config, nullptr);
+	deserializer.ReadPropertyWithDefault<bool>(108, "write_page_index", data->write_page_index, false);
+	deserializer.ReadPropertyWithDefault<bool>(109, "write_bloom_filter", data->write_bloom_filter, false);
+	deserializer.ReadPropertyWithDefault<double>(110, "bloom_filter_false_positive_ratio",
+	                                             data->bloom_filter_false_positive_ratio, 0.01);
+	deserializer.ReadPropertyWithDefault<bool>(111, "auto_encoding", data->auto_encoding, false);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1239,6 +1311,10 @@ void ParquetExtension::Load(DuckDB &db) {
 	ParquetFileMetadataFunction file_meta_fun;
 	ExtensionUtil::RegisterFunction(db_instance, MultiFileReader::CreateFunctionSet(file_meta_fun));
 
+	// parquet_bloom_probe
+	ParquetBloomProbeFunction bloom_probe_fun;
+	ExtensionUtil::RegisterFunction(db_instance, bloom_probe_fun);
+
 	CopyFunction function("parquet");
 	function.copy_to_bind = ParquetWriteBind;
 	function.copy_to_initialize_global = ParquetWriteInitializeGlobal;
@@ -9,6 +9,7 @@
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #endif
 
 namespace duckdb {
@@ -24,7 +25,19 @@ public:
 	}
 };
 
-enum class ParquetMetadataOperatorType { META_DATA, SCHEMA, KEY_VALUE_META_DATA, FILE_META_DATA };
+struct ParquetBloomProbeBindData : public ParquetMetaDataBindData {
+	string probe_column_name;
+	Value probe_constant;
+
+public:
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<ParquetBloomProbeBindData>();
+		return ParquetMetaDataBindData::Equals(other_p) && probe_column_name == other.probe_column_name &&
+		       probe_constant == other.probe_constant;
+	}
+};
+
+enum class ParquetMetadataOperatorType { META_DATA, SCHEMA, KEY_VALUE_META_DATA, FILE_META_DATA, BLOOM_PROBE };
 
 struct ParquetMetaDataOperatorData : public GlobalTableFunctionState {
 	explicit ParquetMetaDataOperatorData(ClientContext &context, const vector<LogicalType> &types)
@@ -40,11 +53,14 @@ public:
 	static void BindSchema(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindKeyValueMetaData(vector<LogicalType> &return_types, vector<string> &names);
 	static void BindFileMetaData(vector<LogicalType> &return_types, vector<string> &names);
+	static void BindBloomProbe(vector<LogicalType> &return_types, vector<string> &names);
 
 	void LoadRowGroupMetadata(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadSchemaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadKeyValueMetaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
 	void LoadFileMetaData(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path);
+	void ExecuteBloomProbe(ClientContext &context, const vector<LogicalType> &return_types, const string &file_path,
+	                       const string &column_name, const Value &probe);
 };
 
 template <class T>
@@ -167,6 +183,12 @@ void ParquetMetaDataOperatorData::BindMetaData(vector<LogicalType> &return_types
 
 	names.emplace_back("key_value_metadata");
 	return_types.emplace_back(LogicalType::MAP(LogicalType::BLOB, LogicalType::BLOB));
+
+	names.emplace_back("bloom_filter_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_length");
+	return_types.emplace_back(LogicalType::BIGINT);
 }
 
 Value ConvertParquetStats(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
@@ -301,6 +323,14 @@ void ParquetMetaDataOperatorData::LoadRowGroupMetadata(ClientContext &context, c
 			    23, count,
 			    Value::MAP(LogicalType::BLOB, LogicalType::BLOB, std::move(map_keys), std::move(map_values)));
 
+			// bloom_filter_offset, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    24, count, ParquetElementBigint(col_meta.bloom_filter_offset, col_meta.__isset.bloom_filter_offset));
+
+			// bloom_filter_length, LogicalType::BIGINT
+			current_chunk.SetValue(
+			    25, count, ParquetElementBigint(col_meta.bloom_filter_length, col_meta.__isset.bloom_filter_length));
+
 			count++;
 			if (count >= STANDARD_VECTOR_SIZE) {
 				current_chunk.SetCardinality(count);
@@ -563,6 +593,64 @@ void ParquetMetaDataOperatorData::LoadFileMetaData(ClientContext &context, const
 	collection.InitializeScan(scan_state);
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Probe
+//===--------------------------------------------------------------------===//
+void ParquetMetaDataOperatorData::BindBloomProbe(vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("file_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("row_group_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_excludes");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+}
+
+void ParquetMetaDataOperatorData::ExecuteBloomProbe(ClientContext &context, const vector<LogicalType> &return_types,
+                                                    const string &file_path, const string &column_name,
+                                                    const Value &probe) {
+	collection.Reset();
+	ParquetOptions parquet_options(context);
+	auto reader = make_uniq<ParquetReader>(context, file_path, parquet_options);
+	idx_t probe_column_idx = DConstants::INVALID_INDEX;
+	for (idx_t column_idx = 0; column_idx < reader->names.size(); column_idx++) {
+		if (reader->names[column_idx] == column_name) {
+			probe_column_idx = column_idx;
+			break;
+		}
+	}
+	if (probe_column_idx == DConstants::INVALID_INDEX) {
+		throw InvalidInputException("Column %s not found in %s", column_name, file_path);
+	}
+	// probe the bloom filters the same way as an equality filter on the column does
+	auto &probe_type = reader->return_types[probe_column_idx];
+	ConstantFilter filter(ExpressionType::COMPARE_EQUAL, probe.CastAs(context, probe_type));
+
+	idx_t count = 0;
+	DataChunk current_chunk;
+	current_chunk.Initialize(context, return_types);
+	auto meta_data = reader->GetFileMetadata();
+	for (idx_t row_group_idx = 0; row_group_idx < meta_data->row_groups.size(); row_group_idx++) {
+		current_chunk.SetValue(0, count, Value(file_path));
+		current_chunk.SetValue(1, count, Value::BIGINT(row_group_idx));
+		current_chunk.SetValue(
+		    2, count, Value::BOOLEAN(reader->BloomFilterExcludes(row_group_idx, probe_column_idx, filter)));
+
+		count++;
+		if (count >= STANDARD_VECTOR_SIZE) {
+			current_chunk.SetCardinality(count);
+			collection.Append(current_chunk);
+
+			count = 0;
+			current_chunk.Reset();
+		}
+	}
+	current_chunk.SetCardinality(count);
+	collection.Append(current_chunk);
+	collection.InitializeScan(scan_state);
+}
+
 //===--------------------------------------------------------------------===//
 // Bind
 //===--------------------------------------------------------------------===//
@@ -582,11 +670,26 @@ unique_ptr<FunctionData> ParquetMetaDataBind(ClientContext &context, TableFuncti
 	case ParquetMetadataOperatorType::FILE_META_DATA:
 		ParquetMetaDataOperatorData::BindFileMetaData(return_types, names);
 		break;
+	case ParquetMetadataOperatorType::BLOOM_PROBE:
+		ParquetMetaDataOperatorData::BindBloomProbe(return_types, names);
+		break;
 	default:
 		throw InternalException("Unsupported ParquetMetadataOperatorType");
 	}
 
-	auto result = make_uniq<ParquetMetaDataBindData>();
+	unique_ptr<ParquetMetaDataBindData> result;
+	if (TYPE == ParquetMetadataOperatorType::BLOOM_PROBE) {
+		auto probe_bind_data = make_uniq<ParquetBloomProbeBindData>();
+		D_ASSERT(input.inputs.size() == 3);
+		if (input.inputs[1].IsNull() || input.inputs[2].IsNull()) {
+			throw InvalidInputException("Can't have NULL parameters for parquet_bloom_probe");
+		}
+		probe_bind_data->probe_column_name = input.inputs[1].ToString();
+		probe_bind_data->probe_constant = input.inputs[2];
+		result = std::move(probe_bind_data);
+	} else {
+		result = make_uniq<ParquetMetaDataBindData>();
+	}
 	result->return_types = return_types;
 	result->files = MultiFileReader::GetFileList(context, input.inputs[0], "Parquet");
 	return std::move(result);
@@ -611,6 +714,12 @@ unique_ptr<GlobalTableFunctionState> ParquetMetaDataInit(ClientContext &context,
 	case ParquetMetadataOperatorType::FILE_META_DATA:
 		result->LoadFileMetaData(context, bind_data.return_types, bind_data.files[0]);
 		break;
+	case ParquetMetadataOperatorType::BLOOM_PROBE: {
+		auto &bloom_probe_bind_data = input.bind_data->Cast<ParquetBloomProbeBindData>();
+		result->ExecuteBloomProbe(context, bind_data.return_types, bind_data.files[0],
+		                          bloom_probe_bind_data.probe_column_name, bloom_probe_bind_data.probe_constant);
+		break;
+	}
 	default:
 		throw InternalException("Unsupported ParquetMetadataOperatorType");
 	}
@@ -641,6 +750,13 @@ void ParquetMetaDataImplementation(ClientContext &context, TableFunctionInput &d
 				case ParquetMetadataOperatorType::FILE_META_DATA:
 					data.LoadFileMetaData(context, bind_data.return_types, bind_data.files[data.file_index]);
 					break;
+				case ParquetMetadataOperatorType::BLOOM_PROBE: {
+					auto &bloom_probe_bind_data = data_p.bind_data->Cast<ParquetBloomProbeBindData>();
+					data.ExecuteBloomProbe(context, bind_data.return_types, bind_data.files[data.file_index],
+					                       bloom_probe_bind_data.probe_column_name,
+					                       bloom_probe_bind_data.probe_constant);
+					break;
+				}
 				default:
 					throw InternalException("Unsupported ParquetMetadataOperatorType");
 				}
@@ -684,4 +800,11 @@ ParquetFileMetadataFunction::ParquetFileMetadataFunction()
                     ParquetMetaDataInit<ParquetMetadataOperatorType::FILE_META_DATA>) {
 }
 
+ParquetBloomProbeFunction::ParquetBloomProbeFunction()
+    : TableFunction("parquet_bloom_probe", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::ANY},
+                    ParquetMetaDataImplementation<ParquetMetadataOperatorType::BLOOM_PROBE>,
+                    ParquetMetaDataBind<ParquetMetadataOperatorType::BLOOM_PROBE>,
+                    ParquetMetaDataInit<ParquetMetadataOperatorType::BLOOM_PROBE>) {
+}
+
 } // namespace duckdb
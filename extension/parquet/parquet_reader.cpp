@@ -650,13 +650,20 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		// filters contain output chunk index, not file col idx!
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
-		if (stats && filter_entry != reader_data.filters->filters.end()) {
+		if (filter_entry != reader_data.filters->filters.end()) {
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
-			auto prune_result = filter.CheckStatistics(*stats);
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			if (stats) {
+				auto prune_result = filter.CheckStatistics(*stats);
+				if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					skip_chunk = true;
+				}
+			}
+			// the statistics cannot rule out equality filters on high-cardinality columns, but bloom filters can
+			if (!skip_chunk && column_reader->BloomFilterExcludes(group.columns, *state.thrift_file_proto, filter)) {
 				skip_chunk = true;
 			}
+			column_reader->SetDictionaryFilter(&filter);
 			if (skip_chunk) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
@@ -669,6 +676,124 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+static bool FilterRejectsNulls(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (FilterRejectsNulls(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterRejectsNulls(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+void ParquetReader::PrepareDictionaryFilters(ParquetReaderScanState &state) {
+	auto &group = GetGroup(state);
+	if (!reader_data.filters || state.group_offset >= idx_t(group.num_rows)) {
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	for (auto &filter_col : reader_data.filters->filters) {
+		auto &filter_entry = reader_data.filter_map[filter_col.first];
+		if (filter_entry.is_constant) {
+			continue;
+		}
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[filter_entry.index]);
+		if (column_reader->DictionaryFilterExcludes()) {
+			// no value in the dictionary passes the filter, skip the row group
+			state.group_offset = group.num_rows;
+			return;
+		}
+	}
+}
+
+void ParquetReader::PreparePageSkipRanges(ParquetReaderScanState &state) {
+	state.skip_ranges.clear();
+	state.skip_range_idx = 0;
+	auto &group = GetGroup(state);
+	const auto group_rows = idx_t(group.num_rows);
+	if (state.group_offset >= group_rows) {
+		return;
+	}
+
+	// the rows outside of the range of a split row group are scanned by other threads
+	if (state.split_begin > 0) {
+		state.skip_ranges.emplace_back(0, MinValue(state.split_begin, group_rows));
+	}
+	if (state.split_end < group_rows) {
+		state.skip_ranges.emplace_back(state.split_end, group_rows);
+	}
+
+	if (reader_data.filters) {
+		auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+		for (auto &filter_col : reader_data.filters->filters) {
+			auto &filter_entry = reader_data.filter_map[filter_col.first];
+			if (filter_entry.is_constant) {
+				continue;
+			}
+			auto column_reader = root_reader.GetChildReader(reader_data.column_ids[filter_entry.index]);
+			if (column_reader->Type().IsNested()) {
+				continue;
+			}
+			auto offset_index = column_reader->GetOffsetIndex();
+			ColumnIndex column_index;
+			if (!offset_index || !column_reader->ReadColumnIndex(column_index)) {
+				continue;
+			}
+			auto &filter = *filter_col.second;
+			auto &pages = offset_index->page_locations;
+			for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+				bool skip_page;
+				if (page_idx < column_index.null_pages.size() && column_index.null_pages[page_idx]) {
+					skip_page = FilterRejectsNulls(filter);
+				} else {
+					auto stats = column_reader->PageStats(column_index, page_idx);
+					skip_page =
+					    stats && filter.CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE;
+				}
+				if (skip_page) {
+					auto begin = idx_t(pages[page_idx].first_row_index);
+					auto end = page_idx + 1 < pages.size() ? idx_t(pages[page_idx + 1].first_row_index) : group_rows;
+					state.skip_ranges.emplace_back(begin, end);
+				}
+			}
+		}
+	}
+	if (state.skip_ranges.empty()) {
+		return;
+	}
+
+	// a row can be skipped if the page of any of the filter columns can be skipped, merge the ranges
+	std::sort(state.skip_ranges.begin(), state.skip_ranges.end());
+	idx_t merged_count = 0;
+	for (auto &range : state.skip_ranges) {
+		if (merged_count > 0 && range.first <= state.skip_ranges[merged_count - 1].second) {
+			auto &merged = state.skip_ranges[merged_count - 1];
+			merged.second = MaxValue(merged.second, range.second);
+		} else {
+			state.skip_ranges[merged_count++] = range;
+		}
+	}
+	state.skip_ranges.resize(merged_count);
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -677,10 +802,79 @@ idx_t ParquetReader::NumRowGroups() {
 	return GetFileMetadata()->row_groups.size();
 }
 
+//! Whether the offset index lets a range of the column start at the page that holds its first row. Repeated columns
+//! are not written with an offset index, and are not read through it either, so a range of them reads all rows
+//! before it
+static bool HasOffsetIndex(ColumnReader &reader, const vector<ColumnChunk> &columns) {
+	if (reader.MaxRepeat() > 0) {
+		return false;
+	}
+	switch (reader.Type().id()) {
+	case LogicalTypeId::LIST:
+	case LogicalTypeId::MAP:
+		return false;
+	case LogicalTypeId::STRUCT:
+	case LogicalTypeId::UNION: {
+		auto &struct_reader = reader.Cast<StructColumnReader>();
+		for (auto &child : struct_reader.child_readers) {
+			if (!HasOffsetIndex(*child, columns)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return reader.FileIdx() < columns.size() && columns[reader.FileIdx()].__isset.offset_index_offset;
+	}
+}
+
+idx_t ParquetReader::NumRowGroupSplits(idx_t group_idx, idx_t max_splits) {
+	// without the page index (or with encryption) every range would decode the rows before it to skip them
+	// remote files are prefetched a row group or a column chunk at a time, so they are not split either
+	if (max_splits <= 1 || parquet_options.encryption_config || !file_handle->OnDiskFile()) {
+		return 1;
+	}
+	auto &group = GetFileMetadata()->row_groups[group_idx];
+	auto &root = root_reader->Cast<StructColumnReader>();
+	for (auto column_id : reader_data.column_ids) {
+		if (column_id == file_row_number_idx) {
+			continue;
+		}
+		if (column_id >= root.child_readers.size() || !HasOffsetIndex(*root.GetChildReader(column_id), group.columns)) {
+			return 1;
+		}
+	}
+	auto splits = idx_t(group.num_rows) / ParquetReaderSplitConfig::MINIMUM_SPLIT_ROWS;
+	return MaxValue<idx_t>(MinValue(splits, max_splits), 1);
+}
+
+bool ParquetReader::BloomFilterExcludes(idx_t group_idx, idx_t column_idx, const TableFilter &filter) {
+	auto &group = GetFileMetadata()->row_groups[group_idx];
+	auto &root = root_reader->Cast<StructColumnReader>();
+	auto file_proto = CreateThriftFileProtocol(allocator, *file_handle, false);
+	return root.GetChildReader(column_idx)->BloomFilterExcludes(group.columns, *file_proto, filter);
+}
+
+void ParquetReader::InitializeScan(ParquetReaderScanState &state, idx_t group_idx, idx_t split_idx,
+                                   idx_t split_count) {
+	D_ASSERT(split_idx < split_count);
+	InitializeScan(state, vector<idx_t> {group_idx});
+	if (split_count <= 1) {
+		return;
+	}
+	// the ranges start at a vector boundary, so the scans of a split row group produce full chunks
+	auto group_rows = idx_t(GetFileMetadata()->row_groups[group_idx].num_rows);
+	auto split_rows = AlignValue<idx_t, STANDARD_VECTOR_SIZE>((group_rows + split_count - 1) / split_count);
+	state.split_begin = MinValue(split_idx * split_rows, group_rows);
+	state.split_end = MinValue(state.split_begin + split_rows, group_rows);
+}
+
 void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read) {
 	state.current_group = -1;
 	state.finished = false;
 	state.group_offset = 0;
+	state.split_begin = 0;
+	state.split_end = NumericLimits<idx_t>::Maximum();
 	state.group_idx_list = std::move(groups_to_read);
 	state.sel.Initialize(STANDARD_VECTOR_SIZE);
 	if (!state.file_handle || state.file_handle->path != file_handle->path) {
@@ -826,7 +1020,7 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
-static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+void ParquetReader::ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
 		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
@@ -923,6 +1117,8 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PrepareDictionaryFilters(state);
+		PreparePageSkipRanges(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -974,7 +1170,31 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	// skip over the rows that the page index ruled out, the column readers jump over their pages
+	idx_t group_rows = GetGroup(state).num_rows;
+	while (state.skip_range_idx < state.skip_ranges.size()) {
+		auto &range = state.skip_ranges[state.skip_range_idx];
+		if (state.group_offset < range.first) {
+			group_rows = range.first;
+			break;
+		}
+		if (state.group_offset < range.second) {
+			for (auto file_col_idx : reader_data.column_ids) {
+				root_reader.GetChildReader(file_col_idx)->Skip(range.second - state.group_offset);
+			}
+			state.group_offset = range.second;
+		}
+		state.skip_range_idx++;
+	}
+	if (state.group_offset >= idx_t(GetGroup(state).num_rows)) {
+		// the rest of the row group was skipped, continue with the next one
+		result.SetCardinality(0);
+		return true;
+	}
+
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, group_rows - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -998,8 +1218,6 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (reader_data.filters) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
 
@@ -1025,7 +1243,9 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				child_reader->Read(result.size(), filter_mask, define_ptr, repeat_ptr, result_vector);
 				need_to_read[id] = false;
 
-				ApplyFilter(result_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				if (!child_reader->DictionaryFilterApplied()) {
+					ApplyFilter(result_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				}
 			}
 		}
 
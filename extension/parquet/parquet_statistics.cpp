@@ -5,7 +5,11 @@
 #include "parquet_timestamp.hpp"
 #include "string_column_reader.hpp"
 #include "struct_column_reader.hpp"
+#include "zstd/common/xxhash.h"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/common/bitset.hpp"
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/value.hpp"
@@ -285,8 +289,31 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformStatistics(reader, column_chunk.meta_data.statistics);
+}
+
+unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformPageStatistics(const ColumnReader &reader,
+                                                                           const ColumnIndex &column_index,
+                                                                           idx_t page_idx) {
+	if (page_idx >= column_index.null_pages.size() || page_idx >= column_index.min_values.size() ||
+	    page_idx >= column_index.max_values.size() || column_index.null_pages[page_idx]) {
+		// null pages have no min/max
+		return nullptr;
+	}
+	// the min/max of a page are stored like the min_value/max_value of the column chunk
+	duckdb_parquet::format::Statistics parquet_stats;
+	parquet_stats.__set_min_value(column_index.min_values[page_idx]);
+	parquet_stats.__set_max_value(column_index.max_values[page_idx]);
+	if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+		parquet_stats.__set_null_count(column_index.null_counts[page_idx]);
+	}
+	return TransformStatistics(reader, parquet_stats);
+}
 
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformStatistics(const ColumnReader &reader,
+                                            const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
 
@@ -352,4 +379,238 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	return row_group_stats;
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Filters
+//===--------------------------------------------------------------------===//
+// Hash a constant the way its value is stored in the column (i.e. its plain encoding)
+static bool HashConstant(const ColumnReader &reader, const Value &constant, uint64_t &hash) {
+	auto &type = reader.Type();
+	if (constant.IsNull() || constant.type() != type) {
+		return false;
+	}
+	switch (reader.Schema().type) {
+	case Type::INT32:
+		switch (type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<int32_t>());
+			return true;
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<uint32_t>());
+			return true;
+		case LogicalTypeId::DATE:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<date_t>().days);
+			return true;
+		case LogicalTypeId::DECIMAL:
+			switch (type.InternalType()) {
+			case PhysicalType::INT16:
+				hash = ParquetBloomFilter::Hash(int32_t(constant.GetValueUnsafe<int16_t>()));
+				return true;
+			case PhysicalType::INT32:
+				hash = ParquetBloomFilter::Hash(constant.GetValueUnsafe<int32_t>());
+				return true;
+			default:
+				return false;
+			}
+		default:
+			return false;
+		}
+	case Type::INT64:
+		switch (type.id()) {
+		case LogicalTypeId::BIGINT:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<int64_t>());
+			return true;
+		case LogicalTypeId::UBIGINT:
+			hash = ParquetBloomFilter::Hash(constant.GetValue<uint64_t>());
+			return true;
+		case LogicalTypeId::DECIMAL:
+			switch (type.InternalType()) {
+			case PhysicalType::INT16:
+				hash = ParquetBloomFilter::Hash(int64_t(constant.GetValueUnsafe<int16_t>()));
+				return true;
+			case PhysicalType::INT32:
+				hash = ParquetBloomFilter::Hash(int64_t(constant.GetValueUnsafe<int32_t>()));
+				return true;
+			case PhysicalType::INT64:
+				hash = ParquetBloomFilter::Hash(constant.GetValueUnsafe<int64_t>());
+				return true;
+			default:
+				return false;
+			}
+		default:
+			return false;
+		}
+	case Type::FLOAT: {
+		if (type.id() != LogicalTypeId::FLOAT) {
+			return false;
+		}
+		// -0.0 equals 0.0 (and NaN equals NaN), but their bits differ
+		auto value = constant.GetValue<float>();
+		if (value == 0 || Value::IsNan(value)) {
+			return false;
+		}
+		hash = ParquetBloomFilter::Hash(value);
+		return true;
+	}
+	case Type::DOUBLE: {
+		if (type.id() != LogicalTypeId::DOUBLE) {
+			return false;
+		}
+		auto value = constant.GetValue<double>();
+		if (value == 0 || Value::IsNan(value)) {
+			return false;
+		}
+		hash = ParquetBloomFilter::Hash(value);
+		return true;
+	}
+	case Type::BYTE_ARRAY: {
+		if (type.id() != LogicalTypeId::VARCHAR && type.id() != LogicalTypeId::BLOB) {
+			return false;
+		}
+		auto &value = StringValue::Get(constant);
+		hash = ParquetBloomFilter::Hash(const_data_ptr_cast(value.c_str()), value.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetStatisticsUtils::BloomFilterSupported(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterSupported(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterSupported(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetStatisticsUtils::BloomFilterExcludes(const ColumnReader &reader, const ParquetBloomFilter &bloom_filter,
+                                                 const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		uint64_t hash;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    !HashConstant(reader, constant_filter.constant, hash)) {
+			return false;
+		}
+		return !bloom_filter.FilterCheck(hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterExcludes(reader, bloom_filter, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterExcludes(reader, bloom_filter, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+// the salts of the eight hash functions, taken from the Parquet specification
+static constexpr const uint32_t BLOOM_FILTER_SALT[ParquetBloomFilter::BLOCK_WORDS] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes) {
+	D_ASSERT(num_bytes > 0 && num_bytes % BLOCK_SIZE == 0);
+	block_count = num_bytes / BLOCK_SIZE;
+	bits.resize(block_count * BLOCK_WORDS, 0);
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	// the upper 32 bits select the block, the lower 32 bits the bits within the block
+	auto block = bits.data() + ((hash >> 32) * block_count >> 32) * BLOCK_WORDS;
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < BLOCK_WORDS; i++) {
+		block[i] |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block = bits.data() + ((hash >> 32) * block_count >> 32) * BLOCK_WORDS;
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < BLOCK_WORDS; i++) {
+		if (!(block[i] & (uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+idx_t ParquetBloomFilter::EstimateEntries() const {
+	idx_t zero_bits = 0;
+	for (auto &word : bits) {
+		zero_bits += 32 - bitset<32>(word).count();
+	}
+	if (zero_bits == 0) {
+		return NumericLimits<idx_t>::Maximum();
+	}
+	// every value sets one bit in each word of its block: after n values a bit is still unset with probability
+	// (31/32)^(n / block_count)
+	auto zero_ratio = double(zero_bits) / double(bits.size() * 32);
+	return idx_t(std::log(zero_ratio) / std::log(31.0 / 32.0) * double(block_count));
+}
+
+void ParquetBloomFilter::Shrink(idx_t num_bytes) {
+	D_ASSERT(num_bytes > 0 && num_bytes % BLOCK_SIZE == 0);
+	// a power of two block count selects the block by the upper bits of the hash, so halving the filter maps
+	// blocks 2i and 2i + 1 to block i
+	while (block_count * BLOCK_SIZE > num_bytes && block_count % 2 == 0) {
+		block_count /= 2;
+		for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+			for (idx_t i = 0; i < BLOCK_WORDS; i++) {
+				bits[block_idx * BLOCK_WORDS + i] =
+				    bits[2 * block_idx * BLOCK_WORDS + i] | bits[(2 * block_idx + 1) * BLOCK_WORDS + i];
+			}
+		}
+		bits.resize(block_count * BLOCK_WORDS);
+	}
+}
+
+idx_t ParquetBloomFilter::OptimalSize(idx_t num_entries, double false_positive_ratio) {
+	D_ASSERT(false_positive_ratio > 0 && false_positive_ratio < 1);
+	// the number of bits an SBBF needs for the false positive ratio: -8 * n / ln(1 - p^(1/8))
+	auto num_bits = -8.0 * double(num_entries) / std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	auto num_bytes = NextPowerOfTwo(MaxValue<idx_t>(idx_t(num_bits / 8), BLOCK_SIZE));
+	return MinValue<idx_t>(num_bytes, MAX_WRITE_SIZE);
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
 } // namespace duckdb
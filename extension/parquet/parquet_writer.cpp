@@ -346,9 +346,12 @@ void VerifyUniqueNames(const vector<string> &names) {
 ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalType> types_p, vector<string> names_p,
                              CompressionCodec::type codec, ChildFieldIDs field_ids_p,
                              const vector<pair<string, string>> &kv_metadata,
-                             shared_ptr<ParquetEncryptionConfig> encryption_config_p)
+                             shared_ptr<ParquetEncryptionConfig> encryption_config_p, bool write_page_index,
+                             bool write_bloom_filter, double bloom_filter_false_positive_ratio, bool auto_encoding)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
-      field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)) {
+      field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
+      write_page_index(write_page_index), write_bloom_filter(write_bloom_filter),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio), auto_encoding(auto_encoding) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -475,6 +478,8 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 		auto write_state = std::move(states[col_idx]);
 		col_writer->FinalizeWrite(*write_state);
 	}
+	// the bloom filters of the row group directly follow its column chunks
+	WriteBloomFilters(row_group);
 
 	// append the row group to the file meta data
 	file_meta_data.row_groups.push_back(row_group);
@@ -495,7 +500,74 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::AddPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+                                 duckdb_parquet::format::OffsetIndex offset_index) {
+	// this is called while flushing a row group (i.e., holding the lock), before it is added to the file meta data
+	ParquetPageIndex page_index;
+	page_index.row_group_idx = file_meta_data.row_groups.size();
+	page_index.column_idx = column_idx;
+	page_index.column_index = std::move(column_index);
+	page_index.offset_index = std::move(offset_index);
+	page_indexes.push_back(std::move(page_index));
+}
+
+void ParquetWriter::WritePageIndexes() {
+	// the column indexes are written together, followed by the offset indexes, so readers can fetch them at once
+	for (auto &page_index : page_indexes) {
+		if (!page_index.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*page_index.column_index);
+		column_chunk.__isset.column_index_offset = true;
+		column_chunk.column_index_offset = int64_t(offset);
+		column_chunk.__isset.column_index_length = true;
+		column_chunk.column_index_length = int32_t(writer->GetTotalWritten() - offset);
+	}
+	for (auto &page_index : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(page_index.offset_index);
+		column_chunk.__isset.offset_index_offset = true;
+		column_chunk.offset_index_offset = int64_t(offset);
+		column_chunk.__isset.offset_index_length = true;
+		column_chunk.offset_index_length = int32_t(writer->GetTotalWritten() - offset);
+	}
+	page_indexes.clear();
+}
+
+void ParquetWriter::AddBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter) {
+	// like AddPageIndex, this is called while flushing a row group
+	ParquetBloomFilterEntry entry;
+	entry.column_idx = column_idx;
+	entry.bloom_filter = std::move(bloom_filter);
+	bloom_filters.push_back(std::move(entry));
+}
+
+void ParquetWriter::WriteBloomFilters(duckdb_parquet::format::RowGroup &row_group) {
+	for (auto &entry : bloom_filters) {
+		auto &column_chunk = row_group.columns[entry.column_idx];
+		auto &bloom_filter = *entry.bloom_filter;
+		auto offset = writer->GetTotalWritten();
+
+		duckdb_parquet::format::BloomFilterHeader header;
+		header.numBytes = int32_t(bloom_filter.GetSize());
+		header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+		header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+		header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+		Write(header);
+		WriteData(bloom_filter.GetData(), bloom_filter.GetSize());
+
+		column_chunk.meta_data.__set_bloom_filter_offset(int64_t(offset));
+		column_chunk.meta_data.__set_bloom_filter_length(int32_t(writer->GetTotalWritten() - offset));
+	}
+	bloom_filters.clear();
+}
+
 void ParquetWriter::Finalize() {
+	WritePageIndexes();
+
 	auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
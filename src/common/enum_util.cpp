@@ -230,6 +230,29 @@ AggregateOrderDependent EnumUtil::FromString<AggregateOrderDependent>(const char
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<AggregateStateGrowth>(AggregateStateGrowth value) {
+	switch(value) {
+	case AggregateStateGrowth::BOUNDED:
+		return "BOUNDED";
+	case AggregateStateGrowth::UNBOUNDED:
+		return "UNBOUNDED";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+AggregateStateGrowth EnumUtil::FromString<AggregateStateGrowth>(const char *value) {
+	if (StringUtil::Equals(value, "BOUNDED")) {
+		return AggregateStateGrowth::BOUNDED;
+	}
+	if (StringUtil::Equals(value, "UNBOUNDED")) {
+		return AggregateStateGrowth::UNBOUNDED;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<AggregateType>(AggregateType value) {
 	switch(value) {
@@ -3817,6 +3840,8 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "DUPLICATE_GROUPS";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
+	case OptimizerType::EAGER_AGGREGATE:
+		return "EAGER_AGGREGATE";
 	case OptimizerType::EXTENSION:
 		return "EXTENSION";
 	default:
@@ -3880,6 +3905,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
+	if (StringUtil::Equals(value, "EAGER_AGGREGATE")) {
+		return OptimizerType::EAGER_AGGREGATE;
+	}
 	if (StringUtil::Equals(value, "EXTENSION")) {
 		return OptimizerType::EXTENSION;
 	}
@@ -4266,6 +4294,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -4436,6 +4466,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "STREAMING_GROUP_BY")) {
+		return PhysicalOperatorType::STREAMING_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
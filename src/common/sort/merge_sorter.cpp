@@ -9,6 +9,10 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 }
 
 void MergeSorter::PerformInMergeRound() {
+	if (state.merge_fan_in > 2) {
+		PerformKWayMerge();
+		return;
+	}
 	while (true) {
 		{
 			lock_guard<mutex> pair_guard(state.lock);
@@ -81,6 +85,188 @@ void MergeSorter::MergePartition() {
 #endif
 }
 
+void MergeSorter::PerformKWayMerge() {
+	while (true) {
+		idx_t group_idx;
+		vector<unique_ptr<SortedBlock>> group;
+		{
+			lock_guard<mutex> group_guard(state.lock);
+			if (state.pair_idx == state.num_pairs) {
+				break;
+			}
+			group_idx = state.pair_idx++;
+			// Take ownership of the input blocks, so that they are destroyed as soon as they are merged
+			const idx_t begin = group_idx * state.merge_fan_in;
+			const idx_t end = MinValue(begin + state.merge_fan_in, state.sorted_blocks.size());
+			for (idx_t i = begin; i < end; i++) {
+				group.push_back(std::move(state.sorted_blocks[i]));
+			}
+		}
+		vector<unique_ptr<SortedBlock>> results;
+		MergeGroup(group, results);
+		lock_guard<mutex> group_guard(state.lock);
+		state.sorted_blocks_temp[group_idx] = std::move(results);
+	}
+}
+
+void MergeSorter::MergeGroup(vector<unique_ptr<SortedBlock>> &group, vector<unique_ptr<SortedBlock>> &results) {
+	const idx_t fan_in = group.size();
+	D_ASSERT(fan_in > 1);
+	// Initialize a reader for every input block
+	idx_t remaining = 0;
+	readers.clear();
+	for (auto &sb : group) {
+		readers.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		auto &reader = *readers.back();
+		reader.sb = sb.get();
+		PinReader(reader);
+		remaining += sb->Count();
+	}
+	// Build the loser tree bottom-up: the leaves are the readers, node 0 holds the overall winner,
+	// and the other nodes hold the loser of the match that was played there
+	loser_tree.resize(fan_in);
+	vector<idx_t> winners(2 * fan_in);
+	for (idx_t i = 0; i < fan_in; i++) {
+		winners[fan_in + i] = i;
+	}
+	for (idx_t node = fan_in - 1; node > 0; node--) {
+		const auto l_idx = winners[2 * node];
+		const auto r_idx = winners[2 * node + 1];
+		const bool r_smaller = ReaderIsSmaller(r_idx, l_idx);
+		winners[node] = r_smaller ? r_idx : l_idx;
+		loser_tree[node] = r_smaller ? l_idx : r_idx;
+	}
+	loser_tree[0] = winners[1];
+	// Merge loop: like the Merge Path merge, every result block holds at most state.block_capacity rows
+	while (remaining > 0) {
+		results.push_back(make_uniq<SortedBlock>(buffer_manager, state));
+		auto &result_block = *results.back();
+		result_block.InitializeWrite();
+		// Pin the blocks we write to
+		auto &radix_block = *result_block.radix_sorting_data.back();
+		auto radix_handle = buffer_manager.Pin(radix_block.block);
+		BufferHandle blob_data_handle;
+		BufferHandle blob_heap_handle;
+		if (!sort_layout.all_constant) {
+			auto &blob_data = *result_block.blob_sorting_data;
+			blob_data_handle = buffer_manager.Pin(blob_data.data_blocks.back()->block);
+			if (!blob_data.layout.AllConstant() && state.external) {
+				blob_heap_handle = buffer_manager.Pin(blob_data.heap_blocks.back()->block);
+			}
+		}
+		auto &payload_data = *result_block.payload_data;
+		auto payload_data_handle = buffer_manager.Pin(payload_data.data_blocks.back()->block);
+		BufferHandle payload_heap_handle;
+		if (!payload_data.layout.AllConstant() && state.external) {
+			payload_heap_handle = buffer_manager.Pin(payload_data.heap_blocks.back()->block);
+		}
+		const idx_t next = MinValue(remaining, state.block_capacity);
+		for (idx_t i = 0; i < next; i++) {
+			// Copy the current row of the winner to the result
+			auto winner = loser_tree[0];
+			auto &reader = *readers[winner];
+			D_ASSERT(reader.block_idx < reader.sb->radix_sorting_data.size());
+			FastMemcpy(radix_handle.Ptr() + radix_block.count * sort_layout.entry_size, reader.RadixPtr(),
+			           sort_layout.entry_size);
+			radix_block.count++;
+			if (!sort_layout.all_constant) {
+				AppendRow(*result_block.blob_sorting_data, blob_data_handle, blob_heap_handle,
+				          *reader.sb->blob_sorting_data, reader);
+			}
+			AppendRow(payload_data, payload_data_handle, payload_heap_handle, *reader.sb->payload_data, reader);
+			// Advance the winner, and replay the matches on the path from its leaf to the root
+			reader.entry_idx++;
+			PinReader(reader);
+			for (idx_t node = (fan_in + winner) / 2; node > 0; node /= 2) {
+				if (ReaderIsSmaller(loser_tree[node], winner)) {
+					std::swap(loser_tree[node], winner);
+				}
+			}
+			loser_tree[0] = winner;
+		}
+		remaining -= next;
+	}
+	readers.clear();
+}
+
+void MergeSorter::PinReader(SBScanState &reader) {
+	auto &sb = *reader.sb;
+	auto &radix_blocks = sb.radix_sorting_data;
+	while (reader.block_idx < radix_blocks.size() && reader.entry_idx == radix_blocks[reader.block_idx]->count) {
+		// Delete references to the block we finished reading
+		radix_blocks[reader.block_idx]->block = nullptr;
+		if (!sort_layout.all_constant) {
+			sb.blob_sorting_data->data_blocks[reader.block_idx]->block = nullptr;
+			if (!sb.blob_sorting_data->layout.AllConstant() && state.external) {
+				sb.blob_sorting_data->heap_blocks[reader.block_idx]->block = nullptr;
+			}
+		}
+		sb.payload_data->data_blocks[reader.block_idx]->block = nullptr;
+		if (!sb.payload_data->layout.AllConstant() && state.external) {
+			sb.payload_data->heap_blocks[reader.block_idx]->block = nullptr;
+		}
+		// Advance block
+		reader.block_idx++;
+		reader.entry_idx = 0;
+	}
+	if (reader.block_idx == radix_blocks.size()) {
+		// Exhausted
+		return;
+	}
+	reader.PinRadix(reader.block_idx);
+	if (!sort_layout.all_constant) {
+		reader.PinData(*sb.blob_sorting_data);
+	}
+	reader.PinData(*sb.payload_data);
+}
+
+bool MergeSorter::ReaderIsSmaller(const idx_t l_idx, const idx_t r_idx) {
+	auto &l = *readers[l_idx];
+	auto &r = *readers[r_idx];
+	const bool l_done = l.block_idx == l.sb->radix_sorting_data.size();
+	const bool r_done = r.block_idx == r.sb->radix_sorting_data.size();
+	if (l_done || r_done) {
+		return l_done == r_done ? l_idx < r_idx : r_done;
+	}
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(l.RadixPtr(), r.RadixPtr(), sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(l, r, l.RadixPtr(), r.RadixPtr(), sort_layout, state.external);
+	}
+	// Ties are broken by reader index, which makes the winner of every match deterministic
+	return comp_res < 0 || (comp_res == 0 && l_idx < r_idx);
+}
+
+void MergeSorter::AppendRow(SortedData &result_data, BufferHandle &result_data_handle, BufferHandle &result_heap_handle,
+                            SortedData &source_data, SBScanState &reader) {
+	const auto &layout = result_data.layout;
+	const idx_t row_width = layout.GetRowWidth();
+	auto &result_data_block = *result_data.data_blocks.back();
+	const data_ptr_t result_data_ptr = result_data_handle.Ptr() + result_data_block.count * row_width;
+	FastMemcpy(result_data_ptr, reader.DataPtr(source_data), row_width);
+	result_data_block.count++;
+	if (layout.AllConstant() || !state.external) {
+		return;
+	}
+	// Copy the heap entry of the row, and store its new offset in the row
+	auto &result_heap_block = *result_data.heap_blocks.back();
+	const data_ptr_t source_heap_ptr = reader.HeapPtr(source_data);
+	const idx_t entry_size = Load<uint32_t>(source_heap_ptr);
+	D_ASSERT(entry_size >= sizeof(uint32_t));
+	if (result_heap_block.byte_offset + entry_size > result_heap_block.capacity) {
+		// We append one entry at a time, so grow the heap block geometrically
+		const idx_t new_capacity =
+		    MaxValue(result_heap_block.byte_offset + entry_size, 2 * result_heap_block.capacity);
+		buffer_manager.ReAllocate(result_heap_block.block, new_capacity);
+		result_heap_block.capacity = new_capacity;
+	}
+	Store<idx_t>(result_heap_block.byte_offset, result_data_ptr + layout.GetHeapOffset());
+	memcpy(result_heap_handle.Ptr() + result_heap_block.byte_offset, source_heap_ptr, entry_size);
+	result_heap_block.count++;
+	result_heap_block.byte_offset += entry_size;
+}
+
 void MergeSorter::GetNextPartition() {
 	// Create result block
 	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
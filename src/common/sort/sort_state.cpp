@@ -3,6 +3,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include <algorithm>
@@ -71,14 +72,16 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
 			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
+				// If we know the strings are short enough, we store them in the sort key completely.
+				// Otherwise, we store a prefix that is long enough to resolve most ties without touching the blob data
 				col_size += StringStats::MaxStringLength(*stats.back());
-				if (col_size > 12) {
-					col_size = 12;
+				if (col_size > SortConstants::MAX_FULL_STRING_KEY_SIZE) {
+					col_size = SortConstants::LONG_STRING_KEY_SIZE;
 				} else {
 					constant_size.back() = true;
 				}
 			} else {
-				col_size = 12;
+				col_size = SortConstants::STRING_KEY_SIZE;
 			}
 			prefix_lengths.back() = col_size - size_before;
 		} else {
@@ -363,7 +366,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_fan_in(2) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -434,14 +437,30 @@ void GlobalSortState::InitializeMergeRound() {
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	// An external merge round reads and writes all data, so we want as few rounds as possible
+	// Merge more than two blocks at once if there are enough blocks to keep all threads busy, and enough memory
+	merge_fan_in = 2;
+	if (external) {
+		const auto threads =
+		    MaxValue<idx_t>((idx_t)TaskScheduler::GetScheduler(buffer_manager.GetDatabase()).NumberOfThreads(), 1);
+		idx_t max_block_size = 1;
+		for (auto &sb : sorted_blocks) {
+			const auto block_count = MaxValue<idx_t>(sb->radix_sorting_data.size(), 1);
+			max_block_size = MaxValue(max_block_size, sb->SizeInBytes() / block_count);
+		}
+		// Every reader of a k-way merge keeps one block pinned
+		const idx_t memory_fan_in = buffer_manager.GetQueryMaxMemory() / 2 / (threads * max_block_size);
+		merge_fan_in = MinValue(MAX_MERGE_FAN_IN, MinValue(memory_fan_in, sorted_blocks.size() / threads));
+		merge_fan_in = MaxValue<idx_t>(merge_fan_in, 2);
+	}
+	// A single block that does not fit in a group is kept on the side
+	if (sorted_blocks.size() % merge_fan_in == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
 	// Init merge path path indices
 	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
+	num_pairs = (sorted_blocks.size() + merge_fan_in - 1) / merge_fan_in;
 	l_start = 0;
 	r_start = 0;
 	// Allocate room for merge results
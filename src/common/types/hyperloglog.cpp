@@ -59,6 +59,13 @@ HyperLogLog *HyperLogLog::MergePointer(HyperLogLog &other) {
 	return new HyperLogLog(new_hll);
 }
 
+void HyperLogLog::MergeInPlace(HyperLogLog &other) {
+	lock_guard<mutex> guard(lock);
+	if (duckdb_hll::hll_merge_into(hll, other.hll) == HLL_C_ERR) {
+		throw InternalException("Could not merge HLLs");
+	}
+}
+
 unique_ptr<HyperLogLog> HyperLogLog::Merge(HyperLogLog logs[], idx_t count) {
 	auto hlls_uptr = unique_ptr<duckdb_hll::robj *[]> {
 		new duckdb_hll::robj *[count]
@@ -280,4 +287,12 @@ void HyperLogLog::AddToLog(UnifiedVectorFormat &vdata, idx_t count, uint64_t ind
 	AddToSingleLogInternal(vdata, count, indices, counts, hll);
 }
 
+void HyperLogLog::AddToLog(uint64_t index, uint8_t count) {
+	AddToRegisterInternal(hll, index, count);
+}
+
+idx_t HyperLogLog::Count(const uint8_t counts[], idx_t count) {
+	return duckdb_hll::hll_count_registers(counts, count);
+}
+
 } // namespace duckdb
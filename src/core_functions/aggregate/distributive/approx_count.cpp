@@ -1,4 +1,5 @@
 #include "duckdb/core_functions/aggregate/distributive_functions.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/hyperloglog.hpp"
@@ -8,42 +9,99 @@
 namespace duckdb {
 
 struct ApproxDistinctCountState {
-	ApproxDistinctCountState() : log(nullptr) {
+	//! The initial number of sparse registers that is allocated
+	static constexpr uint32_t SPARSE_INITIAL_CAPACITY = 8;
+	//! The maximum number of sparse registers: with more registers set, a dense HyperLogLog is (about) as small
+	static constexpr uint32_t SPARSE_MAX_CAPACITY = 256;
+
+	//! The registers that are set, as (index << 8 | count), sorted on the index - allocated in the aggregate arena
+	uint32_t *sparse;
+	//! The number of registers that are set in the sparse representation
+	uint32_t sparse_count;
+	//! The number of registers that fit in the sparse representation
+	uint32_t sparse_capacity;
+	//! The dense HyperLogLog, only created once the sparse representation runs out of space
+	HyperLogLog *log;
+
+	//! Switch from the sparse to the dense representation
+	void ToDense() {
+		D_ASSERT(!log);
+		log = new HyperLogLog();
+		for (idx_t i = 0; i < sparse_count; i++) {
+			log->AddToLog(sparse[i] >> 8, sparse[i] & 0xFF);
+		}
+		sparse = nullptr;
+		sparse_count = 0;
+		sparse_capacity = 0;
 	}
-	~ApproxDistinctCountState() {
+
+	//! Set the register with the given index to (at least) the given count
+	void Insert(uint64_t index, uint8_t count, ArenaAllocator &allocator) {
 		if (log) {
-			delete log;
+			log->AddToLog(index, count);
+			return;
+		}
+		const auto key = uint32_t(index << 8);
+		idx_t pos = std::lower_bound(sparse, sparse + sparse_count, key) - sparse;
+		if (pos < sparse_count && (sparse[pos] >> 8) == index) {
+			if ((sparse[pos] & 0xFF) < count) {
+				sparse[pos] = key | count;
+			}
+			return;
+		}
+		if (sparse_count == sparse_capacity) {
+			if (sparse_capacity == SPARSE_MAX_CAPACITY) {
+				ToDense();
+				log->AddToLog(index, count);
+				return;
+			}
+			auto new_capacity = sparse_capacity == 0 ? SPARSE_INITIAL_CAPACITY : sparse_capacity * 2;
+			auto new_sparse = reinterpret_cast<uint32_t *>(allocator.Allocate(new_capacity * sizeof(uint32_t)));
+			if (sparse_count > 0) {
+				memcpy(new_sparse, sparse, sparse_count * sizeof(uint32_t));
+			}
+			sparse = new_sparse;
+			sparse_capacity = new_capacity;
 		}
+		memmove(sparse + pos + 1, sparse + pos, (sparse_count - pos) * sizeof(uint32_t));
+		sparse[pos] = key | count;
+		sparse_count++;
 	}
-
-	HyperLogLog *log;
 };
 
 struct ApproxCountDistinctFunction {
 	template <class STATE>
 	static void Initialize(STATE &state) {
+		state.sparse = nullptr;
+		state.sparse_count = 0;
+		state.sparse_capacity = 0;
 		state.log = nullptr;
 	}
 
 	template <class STATE, class OP>
-	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
-		if (!source.log) {
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data) {
+		if (source.log) {
+			if (!target.log) {
+				target.ToDense();
+			}
+			target.log->MergeInPlace(*source.log);
 			return;
 		}
-		if (!target.log) {
-			target.log = new HyperLogLog();
+		for (idx_t i = 0; i < source.sparse_count; i++) {
+			target.Insert(source.sparse[i] >> 8, source.sparse[i] & 0xFF, aggr_input_data.allocator);
 		}
-		D_ASSERT(target.log);
-		D_ASSERT(source.log);
-		auto new_log = target.log->MergePointer(*source.log);
-		delete target.log;
-		target.log = new_log;
 	}
 
 	template <class T, class STATE>
 	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
 		if (state.log) {
-			target = state.log->Count();
+			target = T(state.log->Count());
+		} else if (state.sparse_count > 0) {
+			uint8_t counts[ApproxDistinctCountState::SPARSE_MAX_CAPACITY];
+			for (idx_t i = 0; i < state.sparse_count; i++) {
+				counts[i] = state.sparse[i] & 0xFF;
+			}
+			target = T(HyperLogLog::Count(counts, state.sparse_count));
 		} else {
 			target = 0;
 		}
@@ -55,6 +113,7 @@ struct ApproxCountDistinctFunction {
 
 	template <class STATE>
 	static void Destroy(STATE &state, AggregateInputData &aggr_input_data) {
+		// the sparse registers are allocated in the arena
 		if (state.log) {
 			delete state.log;
 			state.log = nullptr;
@@ -62,14 +121,11 @@ struct ApproxCountDistinctFunction {
 	}
 };
 
-static void ApproxCountDistinctSimpleUpdateFunction(Vector inputs[], AggregateInputData &, idx_t input_count,
-                                                    data_ptr_t state, idx_t count) {
+static void ApproxCountDistinctSimpleUpdateFunction(Vector inputs[], AggregateInputData &aggr_input_data,
+                                                    idx_t input_count, data_ptr_t state, idx_t count) {
 	D_ASSERT(input_count == 1);
 
 	auto agg_state = reinterpret_cast<ApproxDistinctCountState *>(state);
-	if (!agg_state->log) {
-		agg_state->log = new HyperLogLog();
-	}
 
 	UnifiedVectorFormat vdata;
 	inputs[0].ToUnifiedFormat(count, vdata);
@@ -80,24 +136,25 @@ static void ApproxCountDistinctSimpleUpdateFunction(Vector inputs[], AggregateIn
 	uint64_t indices[STANDARD_VECTOR_SIZE];
 	uint8_t counts[STANDARD_VECTOR_SIZE];
 	HyperLogLog::ProcessEntries(vdata, inputs[0].GetType(), indices, counts, count);
-	agg_state->log->AddToLog(vdata, count, indices, counts);
+	if (agg_state->log) {
+		agg_state->log->AddToLog(vdata, count, indices, counts);
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		if (vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			agg_state->Insert(indices[i], counts[i], aggr_input_data.allocator);
+		}
+	}
 }
 
-static void ApproxCountDistinctUpdateFunction(Vector inputs[], AggregateInputData &, idx_t input_count,
-                                              Vector &state_vector, idx_t count) {
+static void ApproxCountDistinctUpdateFunction(Vector inputs[], AggregateInputData &aggr_input_data,
+                                              idx_t input_count, Vector &state_vector, idx_t count) {
 	D_ASSERT(input_count == 1);
 
 	UnifiedVectorFormat sdata;
 	state_vector.ToUnifiedFormat(count, sdata);
 	auto states = UnifiedVectorFormat::GetDataNoConst<ApproxDistinctCountState *>(sdata);
 
-	for (idx_t i = 0; i < count; i++) {
-		auto agg_state = states[sdata.sel->get_index(i)];
-		if (!agg_state->log) {
-			agg_state->log = new HyperLogLog();
-		}
-	}
-
 	UnifiedVectorFormat vdata;
 	inputs[0].ToUnifiedFormat(count, vdata);
 
@@ -107,7 +164,14 @@ static void ApproxCountDistinctUpdateFunction(Vector inputs[], AggregateInputDat
 	uint64_t indices[STANDARD_VECTOR_SIZE];
 	uint8_t counts[STANDARD_VECTOR_SIZE];
 	HyperLogLog::ProcessEntries(vdata, inputs[0].GetType(), indices, counts, count);
-	HyperLogLog::AddToLogs(vdata, count, indices, counts, reinterpret_cast<HyperLogLog ***>(states), sdata.sel);
+	// groups only get a dense HyperLogLog once they have many distinct values, so that many small groups stay small
+	for (idx_t i = 0; i < count; i++) {
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			continue;
+		}
+		auto agg_state = states[sdata.sel->get_index(i)];
+		agg_state->Insert(indices[i], counts[i], aggr_input_data.allocator);
+	}
 }
 
 AggregateFunction GetApproxCountDistinctFunction(const LogicalType &input_type) {
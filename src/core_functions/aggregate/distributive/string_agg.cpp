@@ -165,6 +165,7 @@ AggregateFunctionSet StringAggFun::GetFunctions() {
 	    AggregateFunction::StateDestroy<StringAggState, StringAggFunction>);
 	string_agg_param.serialize = StringAggSerialize;
 	string_agg_param.deserialize = StringAggDeserialize;
+	string_agg_param.state_growth = AggregateStateGrowth::UNBOUNDED;
 	string_agg.AddFunction(string_agg_param);
 	string_agg_param.arguments.emplace_back(LogicalType::VARCHAR);
 	string_agg.AddFunction(string_agg_param);
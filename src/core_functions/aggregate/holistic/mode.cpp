@@ -315,6 +315,7 @@ AggregateFunction GetTypedModeFunction(const LogicalType &type) {
 	auto return_type = type.id() == LogicalTypeId::ANY ? LogicalType::VARCHAR : type;
 	auto func = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, return_type);
 	func.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
+	func.state_growth = AggregateStateGrowth::UNBOUNDED;
 	return func;
 }
 
@@ -974,6 +974,7 @@ AggregateFunction GetTypedDiscreteQuantileAggregateFunction(const LogicalType &t
 	auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP>(type, return_type);
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, INPUT_TYPE, OP>;
 	fun.window_init = OP::WindowInit<STATE, INPUT_TYPE>;
+	fun.state_growth = AggregateStateGrowth::UNBOUNDED;
 	return fun;
 }
 
@@ -1096,6 +1097,7 @@ AggregateFunction GetTypedDiscreteQuantileListAggregateFunction(const LogicalTyp
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.state_growth = AggregateStateGrowth::UNBOUNDED;
 	return fun;
 }
 
@@ -1154,6 +1156,7 @@ AggregateFunction GetTypedContinuousQuantileAggregateFunction(const LogicalType
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.state_growth = AggregateStateGrowth::UNBOUNDED;
 	return fun;
 }
 
@@ -1209,6 +1212,7 @@ AggregateFunction GetTypedContinuousQuantileListAggregateFunction(const LogicalT
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, list_entry_t, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.state_growth = AggregateStateGrowth::UNBOUNDED;
 	return fun;
 }
 
@@ -1424,6 +1428,7 @@ AggregateFunction GetTypedMedianAbsoluteDeviationAggregateFunction(const Logical
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	fun.window = AggregateFunction::UnaryWindow<STATE, INPUT_TYPE, TARGET_TYPE, OP>;
 	fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
+	fun.state_growth = AggregateStateGrowth::UNBOUNDED;
 	return fun;
 }
 
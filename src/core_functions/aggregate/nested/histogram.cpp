@@ -167,11 +167,13 @@ static AggregateFunction GetHistogramFunction(const LogicalType &type) {
 
 	using STATE_TYPE = HistogramAggState<T, MAP_TYPE>;
 
-	return AggregateFunction("histogram", {type}, LogicalTypeId::MAP, AggregateFunction::StateSize<STATE_TYPE>,
-	                         AggregateFunction::StateInitialize<STATE_TYPE, HistogramFunction>,
-	                         HistogramUpdateFunction<OP, T, MAP_TYPE>, HistogramCombineFunction<T, MAP_TYPE>,
-	                         HistogramFinalizeFunction<OP, T, MAP_TYPE>, nullptr, HistogramBindFunction,
-	                         AggregateFunction::StateDestroy<STATE_TYPE, HistogramFunction>);
+	AggregateFunction fun("histogram", {type}, LogicalTypeId::MAP, AggregateFunction::StateSize<STATE_TYPE>,
+	                      AggregateFunction::StateInitialize<STATE_TYPE, HistogramFunction>,
+	                      HistogramUpdateFunction<OP, T, MAP_TYPE>, HistogramCombineFunction<T, MAP_TYPE>,
+	                      HistogramFinalizeFunction<OP, T, MAP_TYPE>, nullptr, HistogramBindFunction,
+	                      AggregateFunction::StateDestroy<STATE_TYPE, HistogramFunction>);
+	fun.state_growth = AggregateStateGrowth::UNBOUNDED;
+	return fun;
 }
 
 template <class OP, class T, bool IS_ORDERED>
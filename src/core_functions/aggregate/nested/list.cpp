@@ -203,7 +203,7 @@ AggregateFunction ListFun::GetFunction() {
 	    AggregateFunction({LogicalType::ANY}, LogicalTypeId::LIST, AggregateFunction::StateSize<ListAggState>,
 	                      AggregateFunction::StateInitialize<ListAggState, ListFunction>, ListUpdateFunction,
 	                      ListCombineFunction, ListFinalize, nullptr, ListBindFunction, nullptr, nullptr, nullptr);
-
+	func.state_growth = AggregateStateGrowth::UNBOUNDED;
 	return func;
 }
 
@@ -146,6 +146,30 @@ struct DatePart {
 		UnaryExecutor::GenericExecute<TA, TR, IOP>(input.data[0], result, input.size(), nullptr, true);
 	}
 
+	//! Date parts of a timestamp only depend on its day: timestamps in a vector are often on the same day, so we only
+	//! compute the part once for each run of equal days
+	template <class TR, class OP>
+	static void TimestampDayFunction(DataChunk &input, ExpressionState &state, Vector &result) {
+		D_ASSERT(input.ColumnCount() >= 1);
+		date_t last_date;
+		TR last_part = TR();
+		bool has_last_date = false;
+		UnaryExecutor::ExecuteWithNulls<timestamp_t, TR>(
+		    input.data[0], result, input.size(), [&](timestamp_t input, ValidityMask &mask, idx_t idx) {
+			    if (!Value::IsFinite(input)) {
+				    mask.SetInvalid(idx);
+				    return TR();
+			    }
+			    auto date = Timestamp::GetDate(input);
+			    if (!has_last_date || date != last_date) {
+				    last_part = OP::template Operation<date_t, TR>(date);
+				    last_date = date;
+				    has_last_date = true;
+			    }
+			    return last_part;
+		    });
+	}
+
 	struct YearOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
@@ -1654,6 +1678,15 @@ ScalarFunctionSet GetGenericDatePartFunction(scalar_function_t date_func, scalar
 
 template <class OP>
 static ScalarFunctionSet GetDatePartFunction() {
+	return GetGenericDatePartFunction(
+	    DatePart::UnaryFunction<date_t, int64_t, OP>, DatePart::TimestampDayFunction<int64_t, OP>,
+	    ScalarFunction::UnaryFunction<interval_t, int64_t, OP>, OP::template PropagateStatistics<date_t>,
+	    OP::template PropagateStatistics<timestamp_t>);
+}
+
+//! Time zone parts of a timestamp are not derived from its day
+template <class OP>
+static ScalarFunctionSet GetTimezonePartFunction() {
 	return GetGenericDatePartFunction(
 	    DatePart::UnaryFunction<date_t, int64_t, OP>, DatePart::UnaryFunction<timestamp_t, int64_t, OP>,
 	    ScalarFunction::UnaryFunction<interval_t, int64_t, OP>, OP::template PropagateStatistics<date_t>,
@@ -1983,7 +2016,7 @@ ScalarFunctionSet EraFun::GetFunctions() {
 }
 
 ScalarFunctionSet TimezoneFun::GetFunctions() {
-	auto operator_set = GetDatePartFunction<DatePart::TimezoneOperator>();
+	auto operator_set = GetTimezonePartFunction<DatePart::TimezoneOperator>();
 
 	//	PG also defines timezone(INTERVAL, TIME_TZ) => TIME_TZ
 	operator_set.AddFunction(
@@ -1994,11 +2027,11 @@ ScalarFunctionSet TimezoneFun::GetFunctions() {
 }
 
 ScalarFunctionSet TimezoneHourFun::GetFunctions() {
-	return GetDatePartFunction<DatePart::TimezoneHourOperator>();
+	return GetTimezonePartFunction<DatePart::TimezoneHourOperator>();
 }
 
 ScalarFunctionSet TimezoneMinuteFun::GetFunctions() {
-	return GetDatePartFunction<DatePart::TimezoneMinuteOperator>();
+	return GetTimezonePartFunction<DatePart::TimezoneMinuteOperator>();
 }
 
 ScalarFunctionSet EpochFun::GetFunctions() {
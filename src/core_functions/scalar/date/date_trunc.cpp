@@ -25,6 +25,51 @@ struct DateTrunc {
 		UnaryExecutor::Execute<TA, TR>(left, result, count, UnaryFunction<TA, TR, OP>);
 	}
 
+	//! Truncating to a calendar unit of at least a day only depends on the day of the input: consecutive values are
+	//! often on the same day, so we only run the calendar conversion once for each run of equal days
+	template <class TA, class TR, class OP>
+	struct DayExecutor {
+		static inline void Execute(Vector &left, Vector &result, idx_t count) {
+			date_t last_date;
+			TR last_result = TR();
+			bool has_last_date = false;
+			UnaryExecutor::Execute<TA, TR>(left, result, count, [&](TA input) {
+				if (!Value::IsFinite(input)) {
+					return Cast::template Operation<TA, TR>(input);
+				}
+				auto date = Cast::template Operation<TA, date_t>(input);
+				if (!has_last_date || date != last_date) {
+					last_result = OP::template Operation<date_t, TR>(date);
+					last_date = date;
+					has_last_date = true;
+				}
+				return last_result;
+			});
+		}
+	};
+
+	template <class TR, class OP>
+	struct DayExecutor<interval_t, TR, OP> {
+		static inline void Execute(Vector &left, Vector &result, idx_t count) {
+			UnaryExecute<interval_t, TR, OP>(left, result, count);
+		}
+	};
+
+	template <class TA, class TR, class OP>
+	static inline void UnaryExecuteByDay(Vector &left, Vector &result, idx_t count) {
+		DayExecutor<TA, TR, OP>::Execute(left, result, count);
+	}
+
+	//! Truncates a timestamp to a multiple of a fixed-size unit within the day (rounding towards negative infinity)
+	template <int64_t UNIT>
+	static inline timestamp_t TruncateMicros(timestamp_t input) {
+		auto remainder = input.value % UNIT;
+		if (remainder < 0) {
+			remainder += UNIT;
+		}
+		return timestamp_t(input.value - remainder);
+	}
+
 	struct MillenniumOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
@@ -66,7 +111,9 @@ struct DateTrunc {
 	struct MonthOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			return Date::FromDate(Date::ExtractYear(input), Date::ExtractMonth(input), 1);
+			int32_t yyyy, mm, dd;
+			Date::Convert(input, yyyy, mm, dd);
+			return Date::FromDate(yyyy, mm, 1);
 		}
 	};
 
@@ -94,52 +141,33 @@ struct DateTrunc {
 		}
 	};
 
+	// timestamps are microseconds since the epoch and every day has the same length, so truncating to a unit within
+	// the day does not require a calendar conversion
 	struct HourOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, 0, 0, 0));
+			return TruncateMicros<Interval::MICROS_PER_HOUR>(input);
 		}
 	};
 
 	struct MinuteOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, min, 0, 0));
+			return TruncateMicros<Interval::MICROS_PER_MINUTE>(input);
 		}
 	};
 
 	struct SecondOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, min, sec, 0));
+			return TruncateMicros<Interval::MICROS_PER_SEC>(input);
 		}
 	};
 
 	struct MillisecondOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			micros -= micros % Interval::MICROS_PER_MSEC;
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, min, sec, micros));
+			return TruncateMicros<Interval::MICROS_PER_MSEC>(input);
 		}
 	};
 
@@ -514,29 +542,29 @@ template <typename TA, typename TR>
 static void DateTruncUnaryExecutor(DatePartSpecifier type, Vector &left, Vector &result, idx_t count) {
 	switch (type) {
 	case DatePartSpecifier::MILLENNIUM:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::MillenniumOperator>(left, result, count);
+		DateTrunc::UnaryExecuteByDay<TA, TR, DateTrunc::MillenniumOperator>(left, result, count);
 		break;
 	case DatePartSpecifier::CENTURY:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::CenturyOperator>(left, result, count);
+		DateTrunc::UnaryExecuteByDay<TA, TR, DateTrunc::CenturyOperator>(left, result, count);
 		break;
 	case DatePartSpecifier::DECADE:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::DecadeOperator>(left, result, count);
+		DateTrunc::UnaryExecuteByDay<TA, TR, DateTrunc::DecadeOperator>(left, result, count);
 		break;
 	case DatePartSpecifier::YEAR:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::YearOperator>(left, result, count);
+		DateTrunc::UnaryExecuteByDay<TA, TR, DateTrunc::YearOperator>(left, result, count);
 		break;
 	case DatePartSpecifier::QUARTER:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::QuarterOperator>(left, result, count);
+		DateTrunc::UnaryExecuteByDay<TA, TR, DateTrunc::QuarterOperator>(left, result, count);
 		break;
 	case DatePartSpecifier::MONTH:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::MonthOperator>(left, result, count);
+		DateTrunc::UnaryExecuteByDay<TA, TR, DateTrunc::MonthOperator>(left, result, count);
 		break;
 	case DatePartSpecifier::WEEK:
 	case DatePartSpecifier::YEARWEEK:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::WeekOperator>(left, result, count);
+		DateTrunc::UnaryExecuteByDay<TA, TR, DateTrunc::WeekOperator>(left, result, count);
 		break;
 	case DatePartSpecifier::ISOYEAR:
-		DateTrunc::UnaryExecute<TA, TR, DateTrunc::ISOYearOperator>(left, result, count);
+		DateTrunc::UnaryExecuteByDay<TA, TR, DateTrunc::ISOYearOperator>(left, result, count);
 		break;
 	case DatePartSpecifier::DAY:
 	case DatePartSpecifier::DOW:
@@ -54,7 +54,9 @@ struct TimeBucket {
 	template <typename T>
 	static inline int32_t EpochMonths(T ts) {
 		date_t ts_date = Cast::template Operation<T, date_t>(ts);
-		return (Date::ExtractYear(ts_date) - 1970) * 12 + Date::ExtractMonth(ts_date) - 1;
+		int32_t year, month, day;
+		Date::Convert(ts_date, year, month, day);
+		return (year - 1970) * 12 + month - 1;
 	}
 
 	static inline timestamp_t WidthConvertibleToMicrosCommon(int64_t bucket_width_micros, int64_t ts_micros,
@@ -3,87 +3,70 @@
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/common/vector.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
-AdaptiveFilter::AdaptiveFilter(const Expression &expr)
-    : iteration_count(0), observe_interval(10), execute_interval(20), warmup(true) {
+AdaptiveFilter::AdaptiveFilter(const Expression &expr) : chunk_count(0) {
 	auto &conj_expr = expr.Cast<BoundConjunctionExpression>();
 	D_ASSERT(conj_expr.children.size() > 1);
 	for (idx_t idx = 0; idx < conj_expr.children.size(); idx++) {
-		permutation.push_back(idx);
-		if (idx != conj_expr.children.size() - 1) {
-			swap_likeliness.push_back(100);
-		}
+		predicates.push_back(idx);
+	}
+	permutation = predicates;
+	statistics.resize(predicates.size());
+	for (idx_t idx = 0; idx < predicates.size(); idx++) {
+		order.push_back(idx);
 	}
-	right_random_border = 100 * (conj_expr.children.size() - 1);
 }
 
-AdaptiveFilter::AdaptiveFilter(TableFilterSet *table_filters)
-    : iteration_count(0), observe_interval(10), execute_interval(20), warmup(true) {
+AdaptiveFilter::AdaptiveFilter(TableFilterSet *table_filters) : chunk_count(0) {
 	for (auto &table_filter : table_filters->filters) {
-		permutation.push_back(table_filter.first);
-		swap_likeliness.push_back(100);
+		predicates.push_back(table_filter.first);
+	}
+	permutation = predicates;
+	statistics.resize(predicates.size());
+	for (idx_t idx = 0; idx < predicates.size(); idx++) {
+		order.push_back(idx);
 	}
-	swap_likeliness.pop_back();
-	right_random_border = 100 * (table_filters->filters.size() - 1);
 }
-void AdaptiveFilter::AdaptRuntimeStatistics(double duration) {
-	iteration_count++;
-	runtime_sum += duration;
-
-	if (!warmup) {
-		// the last swap was observed
-		if (observe && iteration_count == observe_interval) {
-			// keep swap if runtime decreased, else reverse swap
-			if (prev_mean - (runtime_sum / iteration_count) <= 0) {
-				// reverse swap because runtime didn't decrease
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
-
-				// decrease swap likeliness, but make sure there is always a small likeliness left
-				if (swap_likeliness[swap_idx] > 1) {
-					swap_likeliness[swap_idx] /= 2;
-				}
-			} else {
-				// keep swap because runtime decreased, reset likeliness
-				swap_likeliness[swap_idx] = 100;
-			}
-			observe = false;
-
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		} else if (!observe && iteration_count == execute_interval) {
-			// save old mean to evaluate swap
-			prev_mean = runtime_sum / iteration_count;
-
-			// get swap index and swap likeliness
-			std::uniform_int_distribution<int> distribution(1, right_random_border); // a <= i <= b
-			idx_t random_number = distribution(generator) - 1;
 
-			swap_idx = random_number / 100;                    // index to be swapped
-			idx_t likeliness = random_number - 100 * swap_idx; // random number between [0, 100)
-
-			// check if swap is going to happen
-			if (swap_likeliness[swap_idx] > likeliness) { // always true for the first swap of an index
-				// swap
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
+void AdaptiveFilter::AdaptRuntimeStatistics(idx_t idx, double duration, idx_t input_count, idx_t output_count) {
+	D_ASSERT(idx < order.size());
+	D_ASSERT(output_count <= input_count);
+	auto &stats = statistics[order[idx]];
+	stats.duration += duration;
+	stats.input_count += double(input_count);
+	stats.output_count += double(output_count);
+}
 
-				// observe whether swap will be applied
-				observe = true;
-			}
+double AdaptiveFilter::GetRank(const PredicateStatistics &stats) {
+	if (stats.input_count == 0) {
+		// never evaluated (e.g., because earlier predicates removed all rows): move it forward to observe it
+		return 0;
+	}
+	const auto cost = stats.duration / stats.input_count;
+	const auto removed_fraction = 1 - stats.output_count / stats.input_count;
+	return cost / MaxValue(removed_fraction, 0.001);
+}
 
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		}
-	} else {
-		if (iteration_count == 5) {
-			// initially set all values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-			observe = false;
-			warmup = false;
-		}
+void AdaptiveFilter::FinishChunk() {
+	if (++chunk_count < ADAPT_INTERVAL || order.size() < 2) {
+		return;
+	}
+	chunk_count = 0;
+	vector<double> ranks;
+	for (auto &stats : statistics) {
+		ranks.push_back(GetRank(stats));
+		// decay the statistics, so that we keep adapting when the data changes
+		stats.duration /= 2;
+		stats.input_count /= 2;
+		stats.output_count /= 2;
+	}
+	// a stable sort keeps the current order of predicates with the same rank
+	std::stable_sort(order.begin(), order.end(), [&](idx_t a, idx_t b) { return ranks[a] < ranks[b]; });
+	for (idx_t i = 0; i < order.size(); i++) {
+		permutation[i] = predicates[order[i]];
 	}
 }
 
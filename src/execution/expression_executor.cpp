@@ -2,8 +2,10 @@
 
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/execution_context.hpp"
-#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/parser/expression_map.hpp"
 #include "duckdb/planner/expression/list.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 
 namespace duckdb {
 
@@ -62,9 +64,85 @@ void ExpressionExecutor::AddExpression(const Expression &expr) {
 	states.push_back(std::move(state));
 }
 
+//! Whether FillSwitch can gather rows of this type into a shared result
+static bool CanShareResult(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::INTERVAL:
+	case PhysicalType::VARCHAR:
+		return true;
+	case PhysicalType::LIST:
+		return CanShareResult(ListType::GetChildType(type));
+	case PhysicalType::STRUCT:
+		for (auto &child : StructType::GetChildTypes(type)) {
+			if (!CanShareResult(child.second)) {
+				return false;
+			}
+		}
+		return true;
+	default:
+		return false;
+	}
+}
+
+static void CountSubExpressions(const Expression &expr, expression_map_t<idx_t> &counts) {
+	// only function calls and casts are worth caching
+	if ((expr.expression_class == ExpressionClass::BOUND_FUNCTION ||
+	     expr.expression_class == ExpressionClass::BOUND_CAST) &&
+	    !expr.IsVolatile() && !expr.IsFoldable() && CanShareResult(expr.return_type)) {
+		auto entry = counts.find(const_cast<Expression &>(expr));
+		if (entry != counts.end()) {
+			// we already counted the children of this expression
+			entry->second++;
+			return;
+		}
+		counts[const_cast<Expression &>(expr)] = 1;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) { CountSubExpressions(child, counts); });
+}
+
+static void AssignSharedResults(ExpressionState &state, expression_map_t<idx_t> &shared) {
+	auto entry = shared.find(const_cast<Expression &>(state.expr));
+	if (entry != shared.end()) {
+		state.shared_result = state.root.shared_results[entry->second].get();
+	}
+	for (auto &child : state.child_states) {
+		AssignSharedResults(*child, shared);
+	}
+}
+
 void ExpressionExecutor::Initialize(const Expression &expression, ExpressionExecutorState &state) {
 	state.executor = this;
 	state.root_state = InitializeState(expression, state);
+
+	// subexpressions that occur more than once within the expression share their result within a chunk
+	// the optimizer only eliminates common subexpressions across projections, and not inside CASE or conjunctions
+	expression_map_t<idx_t> counts;
+	ExpressionIterator::EnumerateChildren(expression,
+	                                      [&](const Expression &child) { CountSubExpressions(child, counts); });
+	expression_map_t<idx_t> shared;
+	for (auto &entry : counts) {
+		if (entry.second > 1) {
+			shared[entry.first] = state.shared_results.size();
+			auto &type = entry.first.get().return_type;
+			state.shared_results.push_back(make_uniq<SharedExpressionResult>(GetAllocator(), type));
+		}
+	}
+	if (!shared.empty()) {
+		AssignSharedResults(*state.root_state, shared);
+	}
 }
 
 void ExpressionExecutor::Execute(DataChunk *input, DataChunk &result) {
@@ -87,6 +165,7 @@ void ExpressionExecutor::ExecuteExpression(DataChunk &input, Vector &result) {
 idx_t ExpressionExecutor::SelectExpression(DataChunk &input, SelectionVector &sel) {
 	D_ASSERT(expressions.size() == 1);
 	SetChunk(&input);
+	states[0]->epoch++;
 	states[0]->profiler.BeginSample();
 	idx_t selected_tuples = Select(*expressions[0], states[0]->root_state.get(), nullptr, input.size(), &sel, nullptr);
 	states[0]->profiler.EndSample(chunk ? chunk->size() : 0);
@@ -101,6 +180,7 @@ void ExpressionExecutor::ExecuteExpression(Vector &result) {
 void ExpressionExecutor::ExecuteExpression(idx_t expr_idx, Vector &result) {
 	D_ASSERT(expr_idx < expressions.size());
 	D_ASSERT(result.GetType().id() == expressions[expr_idx]->return_type.id());
+	states[expr_idx]->epoch++;
 	states[expr_idx]->profiler.BeginSample();
 	Execute(*expressions[expr_idx], states[expr_idx]->root_state.get(), nullptr, chunk ? chunk->size() : 1, result);
 	states[expr_idx]->profiler.EndSample(chunk ? chunk->size() : 0);
@@ -186,6 +266,51 @@ void ExpressionExecutor::Execute(const Expression &expr, ExpressionState *state,
 		    "ExpressionExecutor::Execute called with a result vector of type %s that does not match expression type %s",
 		    result.GetType(), expr.return_type);
 	}
+	if (state && state->shared_result) {
+		ExecuteShared(expr, *state, sel, count, result);
+	} else {
+		ExecuteInternal(expr, state, sel, count, result);
+	}
+	Verify(expr, result, count);
+}
+
+void ExpressionExecutor::ExecuteShared(const Expression &expr, ExpressionState &state, const SelectionVector *sel,
+                                       idx_t count, Vector &result) {
+	auto &shared = *state.shared_result;
+	if (shared.epoch != state.root.epoch) {
+		// first time we evaluate this expression for the current evaluation of the root: invalidate the cache
+		shared.cache.Reset();
+		shared.computed.SetAllInvalid(STANDARD_VECTOR_SIZE);
+		shared.epoch = state.root.epoch;
+	}
+	// find the rows that have not been computed yet
+	idx_t missing_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto row_idx = sel ? sel->get_index(i) : i;
+		if (!shared.computed.RowIsValidUnsafe(row_idx)) {
+			shared.missing_sel.set_index(missing_count++, row_idx);
+			shared.computed.SetValidUnsafe(row_idx);
+		}
+	}
+	// compute them, and add them to the cache
+	auto &cached = shared.cache.data[0];
+	if (!sel && missing_count == count && count > 0) {
+		// all rows are computed at once: keep the result as-is, so that e.g. constant vectors remain constant
+		ExecuteInternal(expr, &state, nullptr, count, cached);
+	} else if (missing_count > 0) {
+		Vector missing(expr.return_type);
+		ExecuteInternal(expr, &state, &shared.missing_sel, missing_count, missing);
+		FillSwitch(missing, cached, shared.missing_sel, missing_count);
+	}
+	if (sel) {
+		result.Slice(cached, *sel, count);
+	} else {
+		result.Reference(cached);
+	}
+}
+
+void ExpressionExecutor::ExecuteInternal(const Expression &expr, ExpressionState *state, const SelectionVector *sel,
+                                         idx_t count, Vector &result) {
 	switch (expr.expression_class) {
 	case ExpressionClass::BOUND_BETWEEN:
 		Execute(expr.Cast<BoundBetweenExpression>(), state, sel, count, result);
@@ -220,7 +345,6 @@ void ExpressionExecutor::Execute(const Expression &expr, ExpressionState *state,
 	default:
 		throw InternalException("Attempting to execute expression of unknown type!");
 	}
-	Verify(expr, result, count);
 }
 
 idx_t ExpressionExecutor::Select(const Expression &expr, ExpressionState *state, const SelectionVector *sel,
@@ -2,9 +2,56 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_case_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 
 namespace duckdb {
 
+//! Lookup table for CASE expressions that compare one expression to many integer constants and return constants,
+//! e.g., CASE x WHEN 1 THEN 'a' WHEN 2 THEN 'b' ... END. Instead of evaluating the WHEN expressions one by one,
+//! the subject is evaluated once and the branch of every row is looked up in a single loop
+struct CaseLookupTable {
+	//! Minimum number of WHEN expressions for which we use a lookup table
+	static constexpr idx_t MINIMUM_CASE_CHECKS = 4;
+	//! Maximum number of entries in a dense lookup table (per WHEN expression)
+	static constexpr idx_t DENSE_ENTRIES_PER_CHECK = 8;
+
+	CaseLookupTable(const Expression &subject, const LogicalType &result_type, idx_t branch_count)
+	    : subject(subject), branch_values(result_type, branch_count), match_sel(STANDARD_VECTOR_SIZE),
+	      branch_sel(STANDARD_VECTOR_SIZE), else_sel(STANDARD_VECTOR_SIZE), else_result_sel(STANDARD_VECTOR_SIZE) {
+	}
+
+	//! The expression that is compared to the constants, and its state
+	const Expression &subject;
+	unique_ptr<ExpressionState> subject_state;
+	//! Holds the subject and ELSE results
+	DataChunk intermediate_chunk;
+	//! The THEN constants, one per branch
+	Vector branch_values;
+	//! Branch per value in [min_value, min_value + dense.size()), or DConstants::INVALID_INDEX
+	int64_t min_value;
+	vector<idx_t> dense;
+	//! Branch per value, if the values are too far apart for a dense table
+	unordered_map<int64_t, idx_t> sparse;
+
+	//! Rows that match a branch, and the branch they match
+	SelectionVector match_sel;
+	SelectionVector branch_sel;
+	//! Rows that match no branch (in the input and in the result)
+	SelectionVector else_sel;
+	SelectionVector else_result_sel;
+
+public:
+	inline idx_t Find(int64_t value) const {
+		if (!dense.empty()) {
+			const auto offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(min_value);
+			return offset < dense.size() ? dense[offset] : DConstants::INVALID_INDEX;
+		}
+		auto entry = sparse.find(value);
+		return entry == sparse.end() ? DConstants::INVALID_INDEX : entry->second;
+	}
+};
+
 struct CaseExpressionState : public ExpressionState {
 	CaseExpressionState(const Expression &expr, ExpressionExecutorState &root)
 	    : ExpressionState(expr, root), true_sel(STANDARD_VECTOR_SIZE), false_sel(STANDARD_VECTOR_SIZE) {
@@ -12,8 +59,122 @@ struct CaseExpressionState : public ExpressionState {
 
 	SelectionVector true_sel;
 	SelectionVector false_sel;
+	//! Set if the CASE expression can be evaluated using a lookup table
+	unique_ptr<CaseLookupTable> lookup;
 };
 
+static bool CaseLookupSupportsType(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Returns the physical value of a constant, which is what the subject vector holds (e.g., the unscaled value of a
+//! DECIMAL or the days since epoch of a DATE)
+static int64_t CaseLookupGetValue(const Value &value) {
+	switch (value.type().InternalType()) {
+	case PhysicalType::INT8:
+		return value.GetValueUnsafe<int8_t>();
+	case PhysicalType::INT16:
+		return value.GetValueUnsafe<int16_t>();
+	case PhysicalType::INT32:
+		return value.GetValueUnsafe<int32_t>();
+	case PhysicalType::INT64:
+		return value.GetValueUnsafe<int64_t>();
+	case PhysicalType::UINT8:
+		return value.GetValueUnsafe<uint8_t>();
+	case PhysicalType::UINT16:
+		return value.GetValueUnsafe<uint16_t>();
+	case PhysicalType::UINT32:
+		return value.GetValueUnsafe<uint32_t>();
+	default:
+		throw InternalException("Unsupported type for CASE lookup table");
+	}
+}
+
+static unique_ptr<CaseLookupTable> CreateCaseLookupTable(const BoundCaseExpression &expr, CaseExpressionState &state) {
+	if (expr.case_checks.size() < CaseLookupTable::MINIMUM_CASE_CHECKS) {
+		return nullptr;
+	}
+	auto result_type = expr.return_type.InternalType();
+	if (!TypeIsConstantSize(result_type) && result_type != PhysicalType::VARCHAR) {
+		return nullptr;
+	}
+	// Every WHEN must compare the same expression to a constant, and every THEN must be a constant
+	optional_ptr<const Expression> subject;
+	vector<std::pair<idx_t, int64_t>> entries;
+	for (idx_t branch_idx = 0; branch_idx < expr.case_checks.size(); branch_idx++) {
+		auto &case_check = expr.case_checks[branch_idx];
+		if (case_check.when_expr->type != ExpressionType::COMPARE_EQUAL ||
+		    case_check.then_expr->type != ExpressionType::VALUE_CONSTANT ||
+		    case_check.then_expr->return_type != expr.return_type) {
+			return nullptr;
+		}
+		auto &comparison = case_check.when_expr->Cast<BoundComparisonExpression>();
+		const bool constant_right = comparison.right->type == ExpressionType::VALUE_CONSTANT;
+		auto &constant_side = constant_right ? *comparison.right : *comparison.left;
+		auto &subject_side = constant_right ? *comparison.left : *comparison.right;
+		if (constant_side.type != ExpressionType::VALUE_CONSTANT) {
+			return nullptr;
+		}
+		if (!subject) {
+			subject = &subject_side;
+			if (subject->IsVolatile() || !CaseLookupSupportsType(subject->return_type)) {
+				return nullptr;
+			}
+		} else if (!subject->Equals(subject_side)) {
+			return nullptr;
+		}
+		auto &value = constant_side.Cast<BoundConstantExpression>().value;
+		if (value.type() != subject->return_type) {
+			return nullptr;
+		}
+		if (!value.IsNull()) {
+			// NULL never matches
+			entries.emplace_back(branch_idx, CaseLookupGetValue(value));
+		}
+	}
+	auto lookup = make_uniq<CaseLookupTable>(*subject, expr.return_type, expr.case_checks.size());
+	lookup->subject_state = ExpressionExecutor::InitializeState(*subject, state.root);
+	lookup->intermediate_chunk.Initialize(state.GetAllocator(), {subject->return_type, expr.return_type});
+	for (idx_t branch_idx = 0; branch_idx < expr.case_checks.size(); branch_idx++) {
+		auto &then_expr = *expr.case_checks[branch_idx].then_expr;
+		lookup->branch_values.SetValue(branch_idx, then_expr.Cast<BoundConstantExpression>().value);
+	}
+	if (entries.empty()) {
+		return lookup;
+	}
+	auto min_value = NumericLimits<int64_t>::Maximum();
+	auto max_value = NumericLimits<int64_t>::Minimum();
+	for (auto &entry : entries) {
+		min_value = MinValue(min_value, entry.second);
+		max_value = MaxValue(max_value, entry.second);
+	}
+	lookup->min_value = min_value;
+	const auto range = static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value);
+	if (range < CaseLookupTable::DENSE_ENTRIES_PER_CHECK * expr.case_checks.size()) {
+		lookup->dense.resize(range + 1, DConstants::INVALID_INDEX);
+	}
+	// Insert in reverse, so that the first matching WHEN wins if a value occurs more than once
+	for (auto entry = entries.rbegin(); entry != entries.rend(); entry++) {
+		if (lookup->dense.empty()) {
+			lookup->sparse[entry->second] = entry->first;
+		} else {
+			lookup->dense[static_cast<uint64_t>(entry->second) - static_cast<uint64_t>(min_value)] = entry->first;
+		}
+	}
+	return lookup;
+}
+
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCaseExpression &expr,
                                                                 ExpressionExecutorState &root) {
 	auto result = make_uniq<CaseExpressionState>(expr, root);
@@ -23,12 +184,89 @@ unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCaseE
 	}
 	result->AddChild(expr.else_expr.get());
 	result->Finalize();
+	result->lookup = CreateCaseLookupTable(expr, *result);
 	return std::move(result);
 }
 
+template <class T>
+static void TemplatedFindBranches(CaseLookupTable &lookup, Vector &subject, const SelectionVector *sel, idx_t count,
+                                  idx_t &match_count, idx_t &else_count) {
+	UnifiedVectorFormat vdata;
+	subject.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = vdata.sel->get_index(i);
+		const auto branch_idx =
+		    vdata.validity.RowIsValid(idx) ? lookup.Find(static_cast<int64_t>(data[idx])) : DConstants::INVALID_INDEX;
+		if (branch_idx != DConstants::INVALID_INDEX) {
+			lookup.match_sel.set_index(match_count, i);
+			lookup.branch_sel.set_index(match_count++, branch_idx);
+		} else {
+			lookup.else_sel.set_index(else_count, sel ? sel->get_index(i) : i);
+			lookup.else_result_sel.set_index(else_count++, i);
+		}
+	}
+}
+
+void ExpressionExecutor::ExecuteCaseLookup(const BoundCaseExpression &expr, ExpressionState &state_p,
+                                           const SelectionVector *sel, idx_t count, Vector &result) {
+	auto &lookup = *state_p.Cast<CaseExpressionState>().lookup;
+	lookup.intermediate_chunk.Reset();
+	auto &subject = lookup.intermediate_chunk.data[0];
+	Execute(lookup.subject, lookup.subject_state.get(), sel, count, subject);
+
+	idx_t match_count = 0;
+	idx_t else_count = 0;
+	switch (subject.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedFindBranches<int8_t>(lookup, subject, sel, count, match_count, else_count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedFindBranches<int16_t>(lookup, subject, sel, count, match_count, else_count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedFindBranches<int32_t>(lookup, subject, sel, count, match_count, else_count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedFindBranches<int64_t>(lookup, subject, sel, count, match_count, else_count);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedFindBranches<uint8_t>(lookup, subject, sel, count, match_count, else_count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedFindBranches<uint16_t>(lookup, subject, sel, count, match_count, else_count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedFindBranches<uint32_t>(lookup, subject, sel, count, match_count, else_count);
+		break;
+	default:
+		throw InternalException("Unsupported type for CASE lookup table");
+	}
+
+	auto else_state = state_p.child_states.back().get();
+	if (else_count == count) {
+		// nothing matched, we can just evaluate the else expression directly
+		Execute(*expr.else_expr, else_state, sel, count, result);
+		return;
+	}
+	if (match_count > 0) {
+		Vector match_values(lookup.branch_values, lookup.branch_sel, match_count);
+		FillSwitch(match_values, result, lookup.match_sel, match_count);
+	}
+	if (else_count > 0) {
+		auto &else_result = lookup.intermediate_chunk.data[1];
+		Execute(*expr.else_expr, else_state, &lookup.else_sel, else_count, else_result);
+		FillSwitch(else_result, result, lookup.else_result_sel, else_count);
+	}
+}
+
 void ExpressionExecutor::Execute(const BoundCaseExpression &expr, ExpressionState *state_p, const SelectionVector *sel,
                                  idx_t count, Vector &result) {
 	auto &state = state_p->Cast<CaseExpressionState>();
+	if (state.lookup) {
+		ExecuteCaseLookup(expr, state, sel, count, result);
+		return;
+	}
 
 	state.intermediate_chunk.Reset();
 
@@ -43,6 +43,11 @@ ExpressionState::ExpressionState(const Expression &expr, ExpressionExecutorState
 ExpressionExecutorState::ExpressionExecutorState() : profiler() {
 }
 
+SharedExpressionResult::SharedExpressionResult(Allocator &allocator, const LogicalType &type)
+    : epoch(DConstants::INVALID_INDEX), computed(STANDARD_VECTOR_SIZE), missing_sel(STANDARD_VECTOR_SIZE) {
+	cache.Initialize(allocator, {type});
+}
+
 void ExpressionState::Verify(ExpressionExecutorState &root_executor) {
 	D_ASSERT(&root_executor == &root);
 	for (auto &entry : child_states) {
@@ -67,6 +67,14 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
 JoinHashTable::~JoinHashTable() {
 }
 
+JoinHashTable::HeavyHitterProbe::HeavyHitterProbe(const vector<LogicalType> &condition_types)
+    : sel(STANDARD_VECTOR_SIZE), count(0), position(0), offset(0), light_sel(STANDARD_VECTOR_SIZE),
+      broadcast_sel(STANDARD_VECTOR_SIZE), rows(LogicalType::POINTER), match_sel(STANDARD_VECTOR_SIZE),
+      result_rows(LogicalType::POINTER) {
+	keys.InitializeEmpty(condition_types);
+	TupleDataCollection::InitializeChunkState(key_state, condition_types);
+}
+
 void JoinHashTable::Merge(JoinHashTable &other) {
 	{
 		lock_guard<mutex> guard(data_lock);
@@ -283,7 +291,56 @@ void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_loc
 	}
 }
 
+void JoinHashTable::DetectHeavyHitters() {
+	heavy_hitters.clear();
+	const auto count = Count();
+	if (count < HEAVY_HITTER_THRESHOLD) {
+		return;
+	}
+
+	// Count the hashes of evenly spaced chunks (the hashes are stored where the next pointers go)
+	const auto chunk_count = data_collection->ChunkCount();
+	const auto chunk_step = MaxValue<idx_t>(chunk_count / (HEAVY_HITTER_SAMPLE_SIZE / STANDARD_VECTOR_SIZE), 1);
+	unordered_map<hash_t, idx_t> hash_counts;
+	idx_t sample_count = 0;
+	for (idx_t chunk_idx = 0; chunk_idx < chunk_count; chunk_idx += chunk_step) {
+		TupleDataChunkIterator iterator(*data_collection, TupleDataPinProperties::KEEP_EVERYTHING_PINNED, chunk_idx,
+		                                chunk_idx + 1, false);
+		const auto row_locations = iterator.GetRowLocations();
+		const auto row_count = iterator.GetCurrentChunkCount();
+		for (idx_t i = 0; i < row_count; i++) {
+			hash_counts[Load<hash_t>(row_locations[i] + pointer_offset)]++;
+		}
+		sample_count += row_count;
+	}
+
+	for (auto &entry : hash_counts) {
+		if (entry.second < HEAVY_HITTER_SAMPLE_COUNT) {
+			continue;
+		}
+		const auto estimated_count = double(entry.second) * double(count) / double(sample_count);
+		if (estimated_count >= double(HEAVY_HITTER_THRESHOLD)) {
+			heavy_hitters.emplace_back();
+			heavy_hitters.back().hash = entry.first;
+		}
+	}
+	std::sort(heavy_hitters.begin(), heavy_hitters.end(),
+	          [](const HeavyHitter &lhs, const HeavyHitter &rhs) { return lhs.hash < rhs.hash; });
+}
+
+idx_t JoinHashTable::FindHeavyHitter(hash_t hash) const {
+	auto entry = std::lower_bound(heavy_hitters.begin(), heavy_hitters.end(), hash,
+	                              [](const HeavyHitter &lhs, const hash_t &rhs) { return lhs.hash < rhs; });
+	if (entry == heavy_hitters.end() || entry->hash != hash) {
+		return DConstants::INVALID_INDEX;
+	}
+	return idx_t(entry - heavy_hitters.begin());
+}
+
 void JoinHashTable::InitializePointerTable() {
+	// Keys with many duplicates get a dense row list instead of a chain, decide on them before Finalize
+	DetectHeavyHitters();
+
 	idx_t capacity = PointerTableCapacity(Count());
 	D_ASSERT(IsPowerOfTwo(capacity));
 
@@ -316,13 +373,79 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 	TupleDataChunkIterator iterator(*data_collection, TupleDataPinProperties::KEEP_EVERYTHING_PINNED, chunk_idx_from,
 	                                chunk_idx_to, false);
 	const auto row_locations = iterator.GetRowLocations();
+	if (heavy_hitters.empty()) {
+		do {
+			const auto count = iterator.GetCurrentChunkCount();
+			for (idx_t i = 0; i < count; i++) {
+				hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
+			}
+			InsertHashes(hashes, count, row_locations, parallel);
+		} while (iterator.Next());
+		return;
+	}
+
+	// Collect the rows of the heavy hitters locally, and only insert the other rows
+	vector<vector<data_ptr_t>> heavy_rows(heavy_hitters.size());
+	data_ptr_t insert_locations[STANDARD_VECTOR_SIZE];
 	do {
 		const auto count = iterator.GetCurrentChunkCount();
+		idx_t insert_count = 0;
 		for (idx_t i = 0; i < count; i++) {
-			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
+			const auto hash = Load<hash_t>(row_locations[i] + pointer_offset);
+			const auto heavy_idx = FindHeavyHitter(hash);
+			if (heavy_idx != DConstants::INVALID_INDEX) {
+				heavy_rows[heavy_idx].push_back(row_locations[i]);
+				continue;
+			}
+			hash_data[insert_count] = hash;
+			insert_locations[insert_count++] = row_locations[i];
 		}
-		InsertHashes(hashes, count, row_locations, parallel);
+		InsertHashes(hashes, insert_count, insert_locations, parallel);
 	} while (iterator.Next());
+
+	lock_guard<mutex> guard(heavy_hitter_lock);
+	for (idx_t heavy_idx = 0; heavy_idx < heavy_hitters.size(); heavy_idx++) {
+		auto &rows = heavy_hitters[heavy_idx].rows;
+		rows.insert(rows.end(), heavy_rows[heavy_idx].begin(), heavy_rows[heavy_idx].end());
+	}
+}
+
+void JoinHashTable::SelectHeavyHitters(ScanStructure &ss, Vector &hashes, const SelectionVector *&current_sel) {
+	if (heavy_hitters.empty()) {
+		return;
+	}
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(ss.count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	// Most probe chunks have no heavy hitter keys at all
+	idx_t first_heavy = 0;
+	for (; first_heavy < ss.count; first_heavy++) {
+		const auto idx = current_sel->get_index(first_heavy);
+		if (FindHeavyHitter(hash_data[hdata.sel->get_index(idx)]) != DConstants::INVALID_INDEX) {
+			break;
+		}
+	}
+	if (first_heavy == ss.count) {
+		return;
+	}
+
+	ss.heavy = make_uniq<HeavyHitterProbe>(condition_types);
+	auto &heavy = *ss.heavy;
+	idx_t light_count = 0;
+	for (idx_t i = 0; i < ss.count; i++) {
+		const auto idx = current_sel->get_index(i);
+		const auto heavy_idx =
+		    i < first_heavy ? DConstants::INVALID_INDEX : FindHeavyHitter(hash_data[hdata.sel->get_index(idx)]);
+		if (heavy_idx == DConstants::INVALID_INDEX) {
+			heavy.light_sel.set_index(light_count++, idx);
+		} else {
+			heavy.sel.set_index(heavy.count, idx);
+			heavy.heavy_hitter[heavy.count++] = heavy_idx;
+		}
+	}
+	ss.count = light_count;
+	current_sel = &heavy.light_sel;
 }
 
 unique_ptr<ScanStructure> JoinHashTable::InitializeScanStructure(DataChunk &keys, TupleDataChunkState &key_state,
@@ -354,6 +477,7 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 
 	if (precomputed_hashes) {
 		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		SelectHeavyHitters(*ss, *precomputed_hashes, current_sel);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
@@ -361,6 +485,7 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 
 		// now initialize the pointers of the scan structure based on the hashes
 		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+		SelectHeavyHitters(*ss, hashes, current_sel);
 	}
 
 	// create the selection vector linking to only non-empty entries
@@ -410,7 +535,7 @@ bool ScanStructure::PointersExhausted() {
 	// AdvancePointers creates a "new_count" for every pointer advanced during the
 	// previous advance pointers call. If no pointers are advanced, new_count = 0.
 	// count is then set ot new_count.
-	return count == 0;
+	return count == 0 && (!heavy || heavy->position >= heavy->count);
 }
 
 idx_t ScanStructure::ResolvePredicates(DataChunk &keys, SelectionVector &match_sel, SelectionVector *no_match_sel) {
@@ -496,13 +621,16 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 	}
 	if (this->count == 0) {
 		// no pointers left to chase
+		NextHeavyHitterJoin(keys, left, result);
 		return;
 	}
 
 	SelectionVector result_vector(STANDARD_VECTOR_SIZE);
 
 	idx_t result_count = ScanInnerJoin(keys, result_vector);
-	if (result_count > 0) {
+	if (result_count == 0) {
+		NextHeavyHitterJoin(keys, left, result);
+	} else {
 		if (PropagatesBuildSide(ht.join_type)) {
 			// full/right outer join: mark join matches as FOUND in the HT
 			auto ptrs = FlatVector::GetData<data_ptr_t>(pointers);
@@ -532,6 +660,93 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 	}
 }
 
+idx_t ScanStructure::ScanHeavyHitter(DataChunk &keys, idx_t max_count) {
+	auto &probe = *heavy;
+	D_ASSERT(probe.position < probe.count);
+	const auto probe_idx = probe.sel.get_index(probe.position);
+	const auto &rows = ht.heavy_hitters[probe.heavy_hitter[probe.position]].rows;
+	const auto batch_count = MinValue<idx_t>(rows.size() - probe.offset, max_count);
+
+	// Broadcast the probe key and match it against the next vector of rows
+	auto row_ptrs = FlatVector::GetData<data_ptr_t>(probe.rows);
+	for (idx_t i = 0; i < batch_count; i++) {
+		probe.broadcast_sel.set_index(i, probe_idx);
+		probe.match_sel.set_index(i, i);
+		row_ptrs[i] = rows[probe.offset + i];
+	}
+	probe.keys.Slice(keys, probe.broadcast_sel, batch_count);
+	TupleDataCollection::ToUnifiedFormat(probe.key_state, probe.keys);
+	idx_t no_match_count = 0;
+	const auto match_count = ht.row_matcher.Match(probe.keys, probe.key_state.vector_data, probe.match_sel,
+	                                              batch_count, ht.layout, probe.rows, nullptr, no_match_count);
+
+	probe.offset += batch_count;
+	if (probe.offset >= rows.size()) {
+		probe.position++;
+		probe.offset = 0;
+	}
+	return match_count;
+}
+
+data_ptr_t ScanStructure::FindHeavyHitterMatch(DataChunk &keys, idx_t position) {
+	auto &probe = *heavy;
+	probe.position = position;
+	probe.offset = 0;
+	while (probe.position == position) {
+		if (ScanHeavyHitter(keys, STANDARD_VECTOR_SIZE) > 0) {
+			return FlatVector::GetData<data_ptr_t>(probe.rows)[probe.match_sel.get_index(0)];
+		}
+	}
+	return nullptr;
+}
+
+void ScanStructure::NextHeavyHitterJoin(DataChunk &keys, DataChunk &left, DataChunk &result) {
+	if (!heavy) {
+		return;
+	}
+	auto &probe = *heavy;
+	// Accumulate the matches of the heavy probe rows until the result is full
+	SelectionVector result_vector(STANDARD_VECTOR_SIZE);
+	auto result_rows = FlatVector::GetData<data_ptr_t>(probe.result_rows);
+	idx_t result_count = 0;
+	while (probe.position < probe.count && result_count < STANDARD_VECTOR_SIZE) {
+		const auto probe_idx = probe.sel.get_index(probe.position);
+		const auto match_count = ScanHeavyHitter(keys, STANDARD_VECTOR_SIZE - result_count);
+		if (match_count == 0) {
+			continue;
+		}
+		if (found_match) {
+			found_match[probe_idx] = true;
+		}
+		auto row_ptrs = FlatVector::GetData<data_ptr_t>(probe.rows);
+		if (PropagatesBuildSide(ht.join_type)) {
+			// full/right outer join: mark join matches as FOUND in the HT
+			for (idx_t i = 0; i < match_count; i++) {
+				Store<bool>(true, row_ptrs[probe.match_sel.get_index(i)] + ht.tuple_size);
+			}
+		}
+		if (ht.join_type == JoinType::RIGHT_SEMI || ht.join_type == JoinType::RIGHT_ANTI) {
+			continue;
+		}
+		// the probe row on the left, the matching rows of the heavy hitter on the right
+		for (idx_t i = 0; i < match_count; i++) {
+			result_vector.set_index(result_count, probe_idx);
+			result_rows[result_count++] = row_ptrs[probe.match_sel.get_index(i)];
+		}
+	}
+	if (result_count == 0) {
+		return;
+	}
+	result.Slice(left, result_vector, result_count);
+	for (idx_t i = 0; i < ht.output_columns.size(); i++) {
+		auto &vector = result.data[left.ColumnCount() + i];
+		const auto output_col_idx = ht.output_columns[i];
+		D_ASSERT(vector.GetType() == ht.layout.GetTypes()[output_col_idx]);
+		ht.data_collection->Gather(probe.result_rows, *FlatVector::IncrementalSelectionVector(), result_count,
+		                           output_col_idx, vector, *FlatVector::IncrementalSelectionVector());
+	}
+}
+
 void ScanStructure::ScanKeyMatches(DataChunk &keys) {
 	// the semi-join, anti-join and mark-join we handle a differently from the inner join
 	// since there can be at most STANDARD_VECTOR_SIZE results
@@ -551,6 +766,15 @@ void ScanStructure::ScanKeyMatches(DataChunk &keys) {
 		// continue searching for the ones where we did not find a match yet
 		AdvancePointers(no_match_sel, no_match_count);
 	}
+	// the probe rows with a heavy hitter key only need to find a single matching row
+	if (heavy) {
+		for (idx_t position = 0; position < heavy->count; position++) {
+			if (FindHeavyHitterMatch(keys, position)) {
+				found_match[heavy->sel.get_index(position)] = true;
+			}
+		}
+		heavy->position = heavy->count;
+	}
 }
 
 template <bool MATCH>
@@ -765,6 +989,21 @@ void ScanStructure::NextSingleJoin(DataChunk &keys, DataChunk &input, DataChunk
 		// continue searching for the ones where we did not find a match yet
 		AdvancePointers(no_match_sel, no_match_count);
 	}
+	// the probe rows with a heavy hitter key return their first matching row
+	if (heavy) {
+		auto ptrs = FlatVector::GetData<data_ptr_t>(pointers);
+		for (idx_t position = 0; position < heavy->count; position++) {
+			auto row = FindHeavyHitterMatch(keys, position);
+			if (!row) {
+				continue;
+			}
+			const auto index = heavy->sel.get_index(position);
+			ptrs[index] = row;
+			found_match[index] = true;
+			result_sel.set_index(result_count++, index);
+		}
+		heavy->position = heavy->count;
+	}
 	// reference the columns of the left side from the result
 	D_ASSERT(input.ColumnCount() > 0);
 	for (idx_t i = 0; i < input.ColumnCount(); i++) {
@@ -962,6 +1201,7 @@ void JoinHashTable::Repartition(JoinHashTable &global_ht) {
 
 void JoinHashTable::Reset() {
 	data_collection->Reset();
+	heavy_hitters.clear();
 	finalized = false;
 }
 
@@ -1055,6 +1295,7 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 
 	// now initialize the pointers of the scan structure based on the hashes
 	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+	SelectHeavyHitters(*ss, hashes, current_sel);
 
 	// create the selection vector linking to only non-empty entries
 	ss->InitializeSelectionVector(current_sel);
@@ -8,9 +8,9 @@ namespace duckdb {
 
 //! Shared information about a collection of distinct aggregates
 DistinctAggregateCollectionInfo::DistinctAggregateCollectionInfo(const vector<unique_ptr<Expression>> &aggregates,
-                                                                 vector<idx_t> indices)
+                                                                 vector<idx_t> indices, bool expand_inputs)
     : indices(std::move(indices)), aggregates(aggregates) {
-	table_count = CreateTableIndexMap();
+	table_count = CreateTableIndexMap(expand_inputs);
 
 	const idx_t aggregate_count = aggregates.size();
 
@@ -79,37 +79,34 @@ DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionIn
 	radix_tables.resize(info.table_count);
 	grouping_sets.resize(info.table_count);
 
-	for (auto &i : info.indices) {
-		auto &aggregate = info.aggregates[i]->Cast<BoundAggregateExpression>();
+	for (idx_t table_idx = 0; table_idx < info.table_count; table_idx++) {
+		// The first input of the table determines the layout of the table
+		auto &aggregate = info.aggregates[info.table_inputs[table_idx][0]]->Cast<BoundAggregateExpression>();
+		const bool expanded = info.expanded_tables[table_idx];
 
-		D_ASSERT(info.table_map.count(i));
-		idx_t table_idx = info.table_map.at(i);
-		if (radix_tables[table_idx] != nullptr) {
-			//! This aggregate shares a table with another aggregate, and the table is already initialized
-			continue;
-		}
 		// The grouping set contains the indices of the chunk that correspond to the data vector
 		// that will be used to figure out in which bucket the payload should be put
 		auto &grouping_set = grouping_sets[table_idx];
-		//! Populate the group with the children of the aggregate
+		//! Populate the group with the children of the aggregate (or the tag and the value if the table is expanded)
 		for (auto &group : groups) {
 			grouping_set.insert(group);
 		}
 		idx_t group_by_size = group_expressions ? group_expressions->size() : 0;
-		for (idx_t set_idx = 0; set_idx < aggregate.children.size(); set_idx++) {
+		idx_t key_count = expanded ? 2 : aggregate.children.size();
+		for (idx_t set_idx = 0; set_idx < key_count; set_idx++) {
 			grouping_set.insert(set_idx + group_by_size);
 		}
 		// Create the hashtable for the aggregate
 		grouped_aggregate_data[table_idx] = make_uniq<GroupedAggregateData>();
-		grouped_aggregate_data[table_idx]->InitializeDistinct(info.aggregates[i], group_expressions);
+		if (expanded) {
+			grouped_aggregate_data[table_idx]->InitializeDistinctExpanded(aggregate.children[0]->return_type,
+			                                                              group_expressions);
+		} else {
+			grouped_aggregate_data[table_idx]->InitializeDistinct(info.aggregates[info.table_inputs[table_idx][0]],
+			                                                      group_expressions);
+		}
 		radix_tables[table_idx] =
 		    make_uniq<RadixPartitionedHashTable>(grouping_set, *grouped_aggregate_data[table_idx]);
-
-		// Fill the chunk_types (only contains the payload of the distinct aggregates)
-		vector<LogicalType> chunk_types;
-		for (auto &child_p : aggregate.children) {
-			chunk_types.push_back(child_p->return_type);
-		}
 	}
 }
 
@@ -139,31 +136,62 @@ struct FindMatchingAggregate {
 	const aggr_ref_t aggr_r;
 };
 
-idx_t DistinctAggregateCollectionInfo::CreateTableIndexMap() {
-	vector<aggr_ref_t> table_inputs;
+static bool CanExpandTable(const BoundAggregateExpression &table_input, const BoundAggregateExpression &aggregate) {
+	if (table_input.children.size() != 1 || aggregate.children.size() != 1) {
+		return false;
+	}
+	return table_input.children[0]->return_type == aggregate.children[0]->return_type;
+}
+
+idx_t DistinctAggregateCollectionInfo::CreateTableIndexMap(bool expand_inputs) {
+	//! The distinct inputs, and the aggregate that first provided them
+	vector<aggr_ref_t> inputs;
+	vector<idx_t> input_aggregates;
 
 	D_ASSERT(table_map.empty());
 	for (auto &agg_idx : indices) {
 		D_ASSERT(agg_idx < aggregates.size());
 		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
 
-		auto matching_inputs =
-		    std::find_if(table_inputs.begin(), table_inputs.end(), FindMatchingAggregate(std::ref(aggregate)));
-		if (matching_inputs != table_inputs.end()) {
-			//! Assign the existing table to the aggregate
-			idx_t found_idx = std::distance(table_inputs.begin(), matching_inputs);
-			table_map[agg_idx] = found_idx;
+		auto matching_inputs = std::find_if(inputs.begin(), inputs.end(), FindMatchingAggregate(std::ref(aggregate)));
+		if (matching_inputs != inputs.end()) {
+			//! Assign the existing table (and tag) to the aggregate
+			idx_t found_idx = std::distance(inputs.begin(), matching_inputs);
+			table_map[agg_idx] = table_map[input_aggregates[found_idx]];
+			tag_map[agg_idx] = tag_map[input_aggregates[found_idx]];
 			continue;
 		}
-		//! Create a new table and assign its index to the aggregate
-		table_map[agg_idx] = table_inputs.size();
-		table_inputs.push_back(std::ref(aggregate));
+		inputs.push_back(std::ref(aggregate));
+		input_aggregates.push_back(agg_idx);
+
+		//! Try to add the input to an existing table, so the inputs are deduplicated in a single pass
+		idx_t table_idx = table_inputs.size();
+		if (expand_inputs) {
+			for (idx_t candidate_idx = 0; candidate_idx < table_inputs.size(); candidate_idx++) {
+				auto &candidate = table_inputs[candidate_idx];
+				auto &table_input = aggregates[candidate[0]]->Cast<BoundAggregateExpression>();
+				if (candidate.size() < MAX_EXPANDED_INPUTS && CanExpandTable(table_input, aggregate)) {
+					table_idx = candidate_idx;
+					break;
+				}
+			}
+		}
+		if (table_idx == table_inputs.size()) {
+			//! Create a new table
+			table_inputs.emplace_back();
+		}
+		table_map[agg_idx] = table_idx;
+		tag_map[agg_idx] = table_inputs[table_idx].size();
+		table_inputs[table_idx].push_back(agg_idx);
 	}
 	//! Every distinct aggregate needs to be assigned an index
 	D_ASSERT(table_map.size() == indices.size());
 	//! There can not be more tables than there are distinct aggregates
 	D_ASSERT(table_inputs.size() <= indices.size());
 
+	for (auto &table_input : table_inputs) {
+		expanded_tables.push_back(table_input.size() > 1);
+	}
 	return table_inputs.size();
 }
 
@@ -188,12 +216,12 @@ static vector<idx_t> GetDistinctIndices(vector<unique_ptr<Expression>> &aggregat
 }
 
 unique_ptr<DistinctAggregateCollectionInfo>
-DistinctAggregateCollectionInfo::Create(vector<unique_ptr<Expression>> &aggregates) {
+DistinctAggregateCollectionInfo::Create(vector<unique_ptr<Expression>> &aggregates, bool expand_inputs) {
 	vector<idx_t> indices = GetDistinctIndices(aggregates);
 	if (indices.empty()) {
 		return nullptr;
 	}
-	return make_uniq<DistinctAggregateCollectionInfo>(aggregates, std::move(indices));
+	return make_uniq<DistinctAggregateCollectionInfo>(aggregates, std::move(indices), expand_inputs);
 }
 
 bool DistinctAggregateData::IsDistinct(idx_t index) const {
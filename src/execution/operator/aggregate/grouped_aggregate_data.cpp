@@ -1,5 +1,7 @@
 #include "duckdb/execution/operator/aggregate/grouped_aggregate_data.hpp"
 
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+
 namespace duckdb {
 
 idx_t GroupedAggregateData::GroupCount() const {
@@ -68,6 +70,21 @@ void GroupedAggregateData::InitializeDistinct(const unique_ptr<Expression> &aggr
 	}
 }
 
+void GroupedAggregateData::InitializeDistinctExpanded(const LogicalType &value_type,
+                                                      const vector<unique_ptr<Expression>> *groups_p) {
+	if (groups_p) {
+		for (auto &expr : *groups_p) {
+			group_types.push_back(expr->return_type);
+		}
+	}
+	group_types.push_back(LogicalType::UTINYINT);
+	group_types.push_back(value_type);
+	for (idx_t i = 0; i < group_types.size(); i++) {
+		groups.push_back(make_uniq<BoundReferenceExpression>(group_types[i], i));
+	}
+	filter_count = 0;
+}
+
 void GroupedAggregateData::InitializeDistinctGroups(const vector<unique_ptr<Expression>> *groups_p) {
 	if (!groups_p) {
 		return;
@@ -167,7 +167,8 @@ PhysicalHashAggregate::PhysicalHashAggregate(ClientContext &context, vector<Logi
 		}
 	}
 
-	distinct_collection_info = DistinctAggregateCollectionInfo::Create(grouped_aggregate_data.aggregates);
+	// Distinct inputs of the same type are deduplicated in a single (expanded) table
+	distinct_collection_info = DistinctAggregateCollectionInfo::Create(grouped_aggregate_data.aggregates, true);
 
 	for (idx_t i = 0; i < grouping_sets.size(); i++) {
 		groupings.emplace_back(grouping_sets[i], grouped_aggregate_data, distinct_collection_info);
@@ -272,14 +273,33 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 	// Create an empty filter for Sink, since we don't need to update any aggregate states here
 	unsafe_vector<idx_t> empty_filter;
 
-	for (idx_t &idx : distinct_info.indices) {
-		auto &aggregate = grouped_aggregate_data.aggregates[idx]->Cast<BoundAggregateExpression>();
-
-		D_ASSERT(distinct_info.table_map.count(idx));
-		idx_t table_idx = distinct_info.table_map[idx];
-		if (!distinct_data->radix_tables[table_idx]) {
-			continue;
-		}
+	// Selects the rows of the input that pass the filter of the aggregate
+	SelectionVector sel_vec(STANDARD_VECTOR_SIZE);
+	auto select_filtered = [&](idx_t agg_idx, const BoundAggregateExpression &aggregate) {
+		DataChunk filter_chunk;
+		auto &filtered_data = sink.filter_set.GetFilterData(agg_idx);
+		filter_chunk.InitializeEmpty(filtered_data.filtered_payload.GetTypes());
+
+		// Add the filter Vector (BOOL)
+		auto it = filter_indexes.find(aggregate.filter.get());
+		D_ASSERT(it != filter_indexes.end());
+		D_ASSERT(it->second < chunk.data.size());
+		auto &filter_bound_ref = aggregate.filter->Cast<BoundReferenceExpression>();
+		filter_chunk.data[filter_bound_ref.index].Reference(chunk.data[it->second]);
+		filter_chunk.SetCardinality(chunk.size());
+
+		// We cant use the AggregateFilterData::ApplyFilter method, because the chunk we need to
+		// apply the filter to also has the groups, and the filtered_data.filtered_payload does not have those.
+		return filtered_data.filter_executor.SelectExpression(filter_chunk, sel_vec);
+	};
+
+	// The hashes of the groups are the same for all expanded tables, so we compute them (at most) once
+	const idx_t group_by_size = grouped_aggregate_data.groups.size();
+	auto &grouping_set = grouping_sets[grouping_idx];
+	Vector group_hashes(LogicalType::HASH);
+	bool computed_group_hashes = false;
+
+	for (idx_t table_idx = 0; table_idx < distinct_info.table_count; table_idx++) {
 		D_ASSERT(distinct_data->radix_tables[table_idx]);
 		auto &radix_table = *distinct_data->radix_tables[table_idx];
 		auto &radix_global_sink = *distinct_state->radix_states[table_idx];
@@ -288,24 +308,16 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 		InterruptState interrupt_state;
 		OperatorSinkInput sink_input {radix_global_sink, radix_local_sink, interrupt_state};
 
-		if (aggregate.filter) {
-			DataChunk filter_chunk;
-			auto &filtered_data = sink.filter_set.GetFilterData(idx);
-			filter_chunk.InitializeEmpty(filtered_data.filtered_payload.GetTypes());
-
-			// Add the filter Vector (BOOL)
-			auto it = filter_indexes.find(aggregate.filter.get());
-			D_ASSERT(it != filter_indexes.end());
-			D_ASSERT(it->second < chunk.data.size());
-			auto &filter_bound_ref = aggregate.filter->Cast<BoundReferenceExpression>();
-			filter_chunk.data[filter_bound_ref.index].Reference(chunk.data[it->second]);
-			filter_chunk.SetCardinality(chunk.size());
-
-			// We cant use the AggregateFilterData::ApplyFilter method, because the chunk we need to
-			// apply the filter to also has the groups, and the filtered_data.filtered_payload does not have those.
-			SelectionVector sel_vec(STANDARD_VECTOR_SIZE);
-			idx_t count = filtered_data.filter_executor.SelectExpression(filter_chunk, sel_vec);
-
+		auto &table_inputs = distinct_info.table_inputs[table_idx];
+		if (!distinct_info.expanded_tables[table_idx]) {
+			// All aggregates in this table have the same input
+			auto agg_idx = table_inputs[0];
+			auto &aggregate = grouped_aggregate_data.aggregates[agg_idx]->Cast<BoundAggregateExpression>();
+			if (!aggregate.filter) {
+				radix_table.Sink(context, chunk, sink_input, empty_chunk, empty_filter);
+				continue;
+			}
+			idx_t count = select_filtered(agg_idx, aggregate);
 			if (count == 0) {
 				continue;
 			}
@@ -315,7 +327,7 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 			DataChunk filtered_input;
 			filtered_input.InitializeEmpty(chunk.GetTypes());
 
-			for (idx_t group_idx = 0; group_idx < grouped_aggregate_data.groups.size(); group_idx++) {
+			for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
 				auto &group = grouped_aggregate_data.groups[group_idx];
 				auto &bound_ref = group->Cast<BoundReferenceExpression>();
 				filtered_input.data[bound_ref.index].Reference(chunk.data[bound_ref.index]);
@@ -330,8 +342,68 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 			filtered_input.SetCardinality(count);
 
 			radix_table.Sink(context, filtered_input, sink_input, empty_chunk, empty_filter);
-		} else {
-			radix_table.Sink(context, chunk, sink_input, empty_chunk, empty_filter);
+			continue;
+		}
+
+		// The table is expanded: sink the input of every aggregate, keyed on (groups, tag, value)
+		if (!computed_group_hashes && !grouping_set.empty()) {
+			// Hash the groups in the same order as the hash table does (the tag and value are hashed last)
+			vector<LogicalType> group_key_types;
+			for (auto &group_idx : grouping_set) {
+				group_key_types.push_back(grouped_aggregate_data.groups[group_idx]->return_type);
+			}
+			DataChunk group_keys;
+			group_keys.InitializeEmpty(group_key_types);
+			idx_t key_idx = 0;
+			for (auto &group_idx : grouping_set) {
+				auto &bound_ref = grouped_aggregate_data.groups[group_idx]->Cast<BoundReferenceExpression>();
+				group_keys.data[key_idx++].Reference(chunk.data[bound_ref.index]);
+			}
+			group_keys.SetCardinality(chunk);
+			group_keys.Hash(group_hashes);
+		}
+		computed_group_hashes = true;
+
+		DataChunk expanded_input;
+		expanded_input.InitializeEmpty(distinct_data->grouped_aggregate_data[table_idx]->group_types);
+		for (idx_t tag = 0; tag < table_inputs.size(); tag++) {
+			auto agg_idx = table_inputs[tag];
+			auto &aggregate = grouped_aggregate_data.aggregates[agg_idx]->Cast<BoundAggregateExpression>();
+			idx_t count = chunk.size();
+			if (aggregate.filter) {
+				count = select_filtered(agg_idx, aggregate);
+				if (count == 0) {
+					continue;
+				}
+			}
+
+			for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
+				auto &bound_ref = grouped_aggregate_data.groups[group_idx]->Cast<BoundReferenceExpression>();
+				expanded_input.data[group_idx].Reference(chunk.data[bound_ref.index]);
+			}
+			auto &tag_vector = expanded_input.data[group_by_size];
+			auto &value_vector = expanded_input.data[group_by_size + 1];
+			tag_vector.Reference(Value::UTINYINT(static_cast<uint8_t>(tag)));
+			value_vector.Reference(chunk.data[aggregate.children[0]->Cast<BoundReferenceExpression>().index]);
+			expanded_input.SetCardinality(chunk);
+
+			Vector hashes(LogicalType::HASH);
+			if (aggregate.filter) {
+				expanded_input.Slice(sel_vec, count);
+				expanded_input.SetCardinality(count);
+			}
+			if (grouping_set.empty()) {
+				VectorOperations::Hash(tag_vector, hashes, count);
+			} else if (aggregate.filter) {
+				VectorOperations::Copy(group_hashes, hashes, sel_vec, count, 0, 0);
+				VectorOperations::CombineHash(hashes, tag_vector, count);
+			} else {
+				VectorOperations::Copy(group_hashes, hashes, count, 0, 0);
+				VectorOperations::CombineHash(hashes, tag_vector, count);
+			}
+			VectorOperations::CombineHash(hashes, value_vector, count);
+
+			radix_table.Sink(context, expanded_input, sink_input, empty_chunk, empty_filter, hashes);
 		}
 	}
 }
@@ -559,9 +631,7 @@ private:
 	idx_t grouping_idx = 0;
 	unique_ptr<LocalSourceState> radix_table_lstate;
 	bool blocked = false;
-	idx_t aggregation_idx = 0;
-	idx_t payload_idx = 0;
-	idx_t next_payload_idx = 0;
+	idx_t table_idx = 0;
 };
 
 void HashAggregateDistinctFinalizeEvent::Schedule() {
@@ -575,7 +645,6 @@ void HashAggregateDistinctFinalizeEvent::Schedule() {
 }
 
 idx_t HashAggregateDistinctFinalizeEvent::CreateGlobalSources() {
-	auto &aggregates = op.grouped_aggregate_data.aggregates;
 	global_source_states.reserve(op.groupings.size());
 
 	idx_t n_tasks = 0;
@@ -584,24 +653,15 @@ idx_t HashAggregateDistinctFinalizeEvent::CreateGlobalSources() {
 		auto &distinct_state = *gstate.grouping_states[grouping_idx].distinct_state;
 		auto &distinct_data = *grouping.distinct_data;
 
-		vector<unique_ptr<GlobalSourceState>> aggregate_sources;
-		aggregate_sources.reserve(aggregates.size());
-		for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
-			auto &aggregate = aggregates[agg_idx];
-			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
-
-			if (!aggr.IsDistinct()) {
-				aggregate_sources.push_back(nullptr);
-				continue;
-			}
-			D_ASSERT(distinct_data.info.table_map.count(agg_idx));
-
-			auto table_idx = distinct_data.info.table_map.at(agg_idx);
+		// Every table is scanned once, even if it holds the input of multiple aggregates
+		vector<unique_ptr<GlobalSourceState>> table_sources;
+		table_sources.reserve(distinct_data.radix_tables.size());
+		for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
 			auto &radix_table_p = distinct_data.radix_tables[table_idx];
 			n_tasks += radix_table_p->MaxThreads(*distinct_state.radix_states[table_idx]);
-			aggregate_sources.push_back(radix_table_p->GetGlobalSourceState(context));
+			table_sources.push_back(radix_table_p->GetGlobalSourceState(context));
 		}
-		global_source_states.push_back(std::move(aggregate_sources));
+		global_source_states.push_back(std::move(table_sources));
 	}
 
 	return MaxValue<idx_t>(n_tasks, 1);
@@ -620,9 +680,7 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::ExecuteTask(TaskExecution
 			return res;
 		}
 		D_ASSERT(res == TaskExecutionResult::TASK_FINISHED);
-		aggregation_idx = 0;
-		payload_idx = 0;
-		next_payload_idx = 0;
+		table_idx = 0;
 		local_sink_state = nullptr;
 	}
 	event->FinishTask();
@@ -668,42 +726,44 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 
 	const auto &finalize_event = event->Cast<HashAggregateDistinctFinalizeEvent>();
 
-	auto &agg_idx = aggregation_idx;
-	for (; agg_idx < op.grouped_aggregate_data.aggregates.size(); agg_idx++) {
-		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
-
-		if (!blocked) {
-			// Forward the payload idx
-			payload_idx = next_payload_idx;
-			next_payload_idx = payload_idx + aggregate.children.size();
-		}
-
-		// If aggregate is not distinct, skip it
-		if (!distinct_data.IsDistinct(agg_idx)) {
-			continue;
-		}
+	// The offsets of the children of the aggregates in the aggregate input chunk
+	vector<idx_t> payload_offsets;
+	idx_t payload_idx = 0;
+	for (auto &aggregate : aggregates) {
+		payload_offsets.push_back(payload_idx);
+		payload_idx += aggregate->Cast<BoundAggregateExpression>().children.size();
+	}
 
-		D_ASSERT(distinct_data.info.table_map.count(agg_idx));
-		const auto &table_idx = distinct_data.info.table_map.at(agg_idx);
+	for (; table_idx < distinct_data.radix_tables.size(); table_idx++) {
 		auto &radix_table = distinct_data.radix_tables[table_idx];
+		const bool expanded = info.expanded_tables[table_idx];
 
 		auto &sink = *distinct_state.radix_states[table_idx];
 		if (!blocked) {
 			radix_table_lstate = radix_table->GetLocalSourceState(execution_context);
 		}
 		auto &local_source = *radix_table_lstate;
-		OperatorSourceInput source_input {*finalize_event.global_source_states[grouping_idx][agg_idx], local_source,
+		OperatorSourceInput source_input {*finalize_event.global_source_states[grouping_idx][table_idx], local_source,
 		                                  interrupt_state};
 
 		// Create a duplicate of the output_chunk, because of multi-threading we cant alter the original
 		DataChunk output_chunk;
 		output_chunk.Initialize(executor.context, distinct_state.distinct_output_chunks[table_idx]->GetTypes());
 
+		// For expanded tables, the rows of the output chunk are split by the tag of their input
+		vector<SelectionVector> tag_sels;
+		vector<idx_t> tag_counts;
+		if (expanded) {
+			for (idx_t tag = 0; tag < info.table_inputs[table_idx].size(); tag++) {
+				tag_sels.emplace_back(STANDARD_VECTOR_SIZE);
+			}
+			tag_counts.resize(tag_sels.size());
+		}
+
 		// Fetch all the data from the aggregate ht, and Sink it into the main ht
 		while (true) {
 			output_chunk.Reset();
 			group_chunk.Reset();
-			aggregate_input_chunk.Reset();
 
 			auto res = radix_table->GetData(execution_context, output_chunk, sink, source_input);
 			if (res == SourceResultType::FINISHED) {
@@ -714,22 +774,58 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 				return TaskExecutionResult::TASK_BLOCKED;
 			}
 
-			auto &grouped_aggregate_data = *distinct_data.grouped_aggregate_data[table_idx];
-			for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
-				auto &group = grouped_aggregate_data.groups[group_idx];
-				auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
-				group_chunk.data[bound_ref_expr.index].Reference(output_chunk.data[group_idx]);
+			if (expanded) {
+				std::fill(tag_counts.begin(), tag_counts.end(), 0);
+				UnifiedVectorFormat tag_data;
+				output_chunk.data[group_by_size].ToUnifiedFormat(output_chunk.size(), tag_data);
+				auto tags = UnifiedVectorFormat::GetData<uint8_t>(tag_data);
+				for (idx_t i = 0; i < output_chunk.size(); i++) {
+					auto tag = tags[tag_data.sel->get_index(i)];
+					tag_sels[tag].set_index(tag_counts[tag]++, i);
+				}
 			}
-			group_chunk.SetCardinality(output_chunk);
 
-			for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size; child_idx++) {
-				aggregate_input_chunk.data[payload_idx + child_idx].Reference(
-				    output_chunk.data[group_by_size + child_idx]);
+			// Sink the data into the main ht, for every aggregate that uses this table
+			for (auto &agg_idx : info.indices) {
+				if (info.table_map.at(agg_idx) != table_idx) {
+					continue;
+				}
+				auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
+				auto child_offset = payload_offsets[agg_idx];
+				aggregate_input_chunk.Reset();
+				if (expanded) {
+					auto tag = info.tag_map.at(agg_idx);
+					auto count = tag_counts[tag];
+					if (count == 0) {
+						continue;
+					}
+					auto &sel = tag_sels[tag];
+					for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
+						auto &group = op.grouped_aggregate_data.groups[group_idx];
+						auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
+						group_chunk.data[bound_ref_expr.index].Slice(output_chunk.data[group_idx], sel, count);
+					}
+					group_chunk.SetCardinality(count);
+					aggregate_input_chunk.data[child_offset].Slice(output_chunk.data[group_by_size + 1], sel, count);
+					aggregate_input_chunk.SetCardinality(count);
+				} else {
+					for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
+						auto &group = op.grouped_aggregate_data.groups[group_idx];
+						auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
+						group_chunk.data[bound_ref_expr.index].Reference(output_chunk.data[group_idx]);
+					}
+					group_chunk.SetCardinality(output_chunk);
+					for (idx_t child_idx = 0; child_idx < aggregate.children.size(); child_idx++) {
+						aggregate_input_chunk.data[child_offset + child_idx].Reference(
+						    output_chunk.data[group_by_size + child_idx]);
+					}
+					aggregate_input_chunk.SetCardinality(output_chunk);
+				}
+
+				// Sink it into the main ht
+				grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk,
+				                              {agg_idx});
 			}
-			aggregate_input_chunk.SetCardinality(output_chunk);
-
-			// Sink it into the main ht
-			grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk, {agg_idx});
 		}
 		blocked = false;
 	}
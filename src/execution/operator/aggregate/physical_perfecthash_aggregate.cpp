@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/execution/perfect_aggregate_hashtable.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
@@ -81,13 +82,18 @@ unique_ptr<PerfectAggregateHashTable> PhysicalPerfectHashAggregate::CreateHT(All
 class PerfectHashAggregateGlobalState : public GlobalSinkState {
 public:
 	PerfectHashAggregateGlobalState(const PhysicalPerfectHashAggregate &op, ClientContext &context)
-	    : ht(op.CreateHT(Allocator::Get(context), context)) {
+	    : ht(op.CreateHT(Allocator::Get(context), context)), page_locks(make_uniq_array<mutex>(ht->PageCount())),
+	      combine_count(0) {
 	}
 
 	//! The lock for updating the global aggregate state
 	mutex lock;
 	//! The global aggregate hash table
 	unique_ptr<PerfectAggregateHashTable> ht;
+	//! The locks for combining the pages of the global aggregate hash table
+	unique_array<mutex> page_locks;
+	//! The amount of threads that have started combining
+	atomic<idx_t> combine_count;
 };
 
 class PerfectHashAggregateLocalState : public LocalSinkState {
@@ -164,8 +170,19 @@ SinkCombineResultType PhysicalPerfectHashAggregate::Combine(ExecutionContext &co
 	auto &lstate = input.local_state.Cast<PerfectHashAggregateLocalState>();
 	auto &gstate = input.global_state.Cast<PerfectHashAggregateGlobalState>();
 
+	// Combine page by page (i.e., by range of groups), so threads can combine concurrently
+	// Threads start at different pages so they don't all wait for the same page
+	auto &ht = *gstate.ht;
+	const auto page_count = ht.PageCount();
+	const auto page_offset = gstate.combine_count++;
+	for (idx_t i = 0; i < page_count; i++) {
+		const auto page_idx = (page_offset + i) % page_count;
+		lock_guard<mutex> guard(gstate.page_locks[page_idx]);
+		ht.CombinePage(*lstate.ht, page_idx);
+	}
+
 	lock_guard<mutex> l(gstate.lock);
-	gstate.ht->Combine(*lstate.ht);
+	ht.TakeAllocators(*lstate.ht);
 
 	return SinkCombineResultType::FINISHED;
 }
@@ -0,0 +1,275 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+#ifdef DEBUG
+	for (auto &group : groups) {
+		D_ASSERT(group->GetExpressionClass() == ExpressionClass::BOUND_REF);
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		D_ASSERT(!aggr.IsDistinct());
+		for (auto &child : aggr.children) {
+			D_ASSERT(child->GetExpressionClass() == ExpressionClass::BOUND_REF);
+		}
+	}
+#endif
+}
+
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ClientContext &client, const PhysicalStreamingAggregate &op)
+	    : op(op), allocator(BufferAllocator::Get(client)), has_group(false), next_sel(STANDARD_VECTOR_SIZE),
+	      update_sel(STANDARD_VECTOR_SIZE), addresses(LogicalType::POINTER) {
+		vector<LogicalType> group_types;
+		for (auto &group : op.groups) {
+			group_types.push_back(group->return_type);
+		}
+		current_group.Initialize(Allocator::Get(client), group_types, 1);
+
+		vector<LogicalType> payload_types;
+		for (auto &aggregate : op.aggregates) {
+			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+			states.push_back(make_unsafe_uniq_array<data_t>(aggr.function.state_size()));
+			for (auto &child : aggr.children) {
+				payload_types.push_back(child->return_type);
+			}
+		}
+		if (!payload_types.empty()) {
+			payload.InitializeEmpty(payload_types);
+		}
+		for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; i++) {
+			next_sel.set_index(i, i + 1);
+		}
+	}
+
+	~StreamingAggregateState() override {
+		if (has_group) {
+			DestroyStates();
+		}
+	}
+
+	//! Whether or not the given row belongs to the current group
+	bool IsCurrentGroup(DataChunk &input, idx_t row) {
+		D_ASSERT(has_group);
+		for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+			auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+			if (!Value::NotDistinctFrom(input.data[group.index].GetValue(row),
+			                            current_group.data[group_idx].GetValue(0))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//! Make the given row the current group and initialize the aggregate states for it
+	void StartGroup(DataChunk &input, idx_t row) {
+		D_ASSERT(!has_group);
+		current_group.Reset();
+		for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+			auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+			VectorOperations::Copy(input.data[group.index], current_group.data[group_idx], row + 1, row, 0);
+		}
+		current_group.SetCardinality(1);
+		for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+			auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+			aggr.function.initialize(states[aggr_idx].get());
+		}
+		has_group = true;
+	}
+
+	void DestroyStates() {
+		for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+			auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+			if (!aggr.function.destructor) {
+				continue;
+			}
+			Vector state_vector(Value::POINTER(CastPointerToValue(states[aggr_idx].get())));
+			state_vector.SetVectorType(VectorType::FLAT_VECTOR);
+			AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+			aggr.function.destructor(state_vector, aggr_input_data, 1);
+		}
+		allocator.Reset();
+	}
+
+	const PhysicalStreamingAggregate &op;
+	//! The allocator used by the aggregate states of the current group
+	ArenaAllocator allocator;
+	//! Whether or not there is a current group
+	bool has_group;
+	//! The values of the current group
+	DataChunk current_group;
+	//! The aggregate states of the current group
+	vector<unsafe_unique_array<data_t>> states;
+	//! Whether or not a row starts a new group
+	bool new_group[STANDARD_VECTOR_SIZE];
+	//! Selects row (i + 1) for row i, to compare every row with its predecessor
+	SelectionVector next_sel;
+	//! The (filtered) rows of a group that update the states
+	SelectionVector update_sel;
+	//! The input of the aggregates for a single group
+	DataChunk payload;
+	//! The state addresses passed to the update function
+	Vector addresses;
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context.client, *this);
+}
+
+static void UpdateGroup(const PhysicalStreamingAggregate &op, StreamingAggregateState &state, DataChunk &input,
+                        idx_t start, idx_t end) {
+	idx_t payload_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		const auto child_count = aggr.children.size();
+
+		// select the rows of the group, skipping the rows that do not pass the filter
+		idx_t update_count = 0;
+		if (aggr.filter) {
+			auto &filter = aggr.filter->Cast<BoundReferenceExpression>();
+			UnifiedVectorFormat fdata;
+			input.data[filter.index].ToUnifiedFormat(input.size(), fdata);
+			auto filter_data = UnifiedVectorFormat::GetData<bool>(fdata);
+			for (idx_t i = start; i < end; i++) {
+				auto fidx = fdata.sel->get_index(i);
+				if (fdata.validity.RowIsValid(fidx) && filter_data[fidx]) {
+					state.update_sel.set_index(update_count++, i);
+				}
+			}
+		} else {
+			for (idx_t i = start; i < end; i++) {
+				state.update_sel.set_index(update_count++, i);
+			}
+		}
+		if (update_count == 0) {
+			payload_idx += child_count;
+			continue;
+		}
+		for (idx_t child_idx = 0; child_idx < child_count; child_idx++) {
+			auto &child = aggr.children[child_idx]->Cast<BoundReferenceExpression>();
+			state.payload.data[payload_idx + child_idx].Slice(input.data[child.index], state.update_sel, update_count);
+		}
+		auto start_of_input = child_count == 0 ? nullptr : &state.payload.data[payload_idx];
+		auto state_ptr = state.states[aggr_idx].get();
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), state.allocator);
+		if (aggr.function.simple_update) {
+			aggr.function.simple_update(start_of_input, aggr_input_data, child_count, state_ptr, update_count);
+		} else {
+			auto address_data = FlatVector::GetData<data_ptr_t>(state.addresses);
+			for (idx_t i = 0; i < update_count; i++) {
+				address_data[i] = state_ptr;
+			}
+			aggr.function.update(start_of_input, aggr_input_data, child_count, state.addresses, update_count);
+		}
+		payload_idx += child_count;
+	}
+}
+
+//! Write the current group and its aggregates as the next row of the chunk, and destroy its states
+static void FinalizeGroup(const PhysicalStreamingAggregate &op, StreamingAggregateState &state, DataChunk &chunk) {
+	D_ASSERT(state.has_group);
+	const auto row = chunk.size();
+	D_ASSERT(row < STANDARD_VECTOR_SIZE);
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		VectorOperations::Copy(state.current_group.data[group_idx], chunk.data[group_idx], 1, 0, row);
+	}
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		Vector state_vector(Value::POINTER(CastPointerToValue(state.states[aggr_idx].get())));
+		state_vector.SetVectorType(VectorType::FLAT_VECTOR);
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), state.allocator);
+		aggr.function.finalize(state_vector, aggr_input_data, chunk.data[op.groups.size() + aggr_idx], 1, row);
+	}
+	chunk.SetCardinality(row + 1);
+	state.DestroyStates();
+	state.has_group = false;
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// mark the rows that start a new group: the input is sorted, so that is every row that differs from its predecessor
+	auto new_group = state.new_group;
+	memset(new_group, 0, sizeof(bool) * count);
+	new_group[0] = !state.has_group || !state.IsCurrentGroup(input, 0);
+	if (count > 1) {
+		SelectionVector distinct_sel(STANDARD_VECTOR_SIZE);
+		for (auto &group_expr : groups) {
+			auto &group = group_expr->Cast<BoundReferenceExpression>();
+			auto &prev = input.data[group.index];
+			Vector next(prev, state.next_sel, count - 1);
+			auto distinct_count =
+			    VectorOperations::DistinctFrom(next, prev, nullptr, count - 1, &distinct_sel, nullptr);
+			for (idx_t i = 0; i < distinct_count; i++) {
+				new_group[distinct_sel.get_index(i) + 1] = true;
+			}
+		}
+	}
+
+	// every completed group produces a single row, so the output always fits in a single chunk
+	idx_t start = 0;
+	while (start < count) {
+		idx_t end = start + 1;
+		while (end < count && !new_group[end]) {
+			end++;
+		}
+		if (new_group[start]) {
+			if (state.has_group) {
+				FinalizeGroup(*this, state, chunk);
+			}
+			state.StartGroup(input, start);
+		}
+		UpdateGroup(*this, state, input, start, end);
+		start = end;
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (state.has_group) {
+		FinalizeGroup(*this, state, chunk);
+	}
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
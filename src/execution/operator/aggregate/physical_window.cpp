@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/aggregate/physical_window.hpp"
 
+#include "duckdb/common/error_data.hpp"
 #include "duckdb/common/operator/add.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
@@ -192,6 +193,8 @@ public:
 
 	//! Get the next task
 	Task NextTask(idx_t hash_bin);
+	//! Execute a task of a partition that is being built, returns false if there are none
+	bool HelpBuild();
 
 	//! Context for executing computations
 	ClientContext &context;
@@ -203,6 +206,8 @@ public:
 	vector<HashGroupSourcePtr> built;
 	//! Serialise access to the built hash groups
 	mutable mutex built_lock;
+	//! The groups that are being built, so idle threads can help to finalize them
+	vector<WindowPartitionSourceState *> building;
 	//! The number of unfinished tasks
 	atomic<idx_t> tasks_remaining;
 
@@ -257,15 +262,27 @@ public:
 	using ExecutorPtr = unique_ptr<WindowExecutor>;
 	using Executors = vector<ExecutorPtr>;
 	using OrderMasks = PartitionGlobalHashGroup::OrderMasks;
+	//! A task that (partially) finalizes an executor: (executor index, task index)
+	using BuildTask = std::pair<idx_t, idx_t>;
+
+	//! The task index of finalizing the executor itself
+	static constexpr idx_t FINALIZE_EXECUTOR = DConstants::INVALID_INDEX;
 
 	WindowPartitionSourceState(ClientContext &context, WindowGlobalSourceState &gsource)
-	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0) {
+	    : context(context), op(gsource.gsink.op), gsource(gsource), next_build_task(0), finished_build_tasks(0),
+	      read_block_idx(0), unscanned(0) {
 		layout.Initialize(gsource.gsink.global_partition->payload_types);
 	}
 
 	unique_ptr<RowDataCollectionScanner> GetScanner() const;
 	void MaterializeSortedData();
 	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
+	//! Execute the tasks with the help of idle threads, and wait for all of them to finish
+	void ExecuteBuildTasks(vector<BuildTask> tasks);
+	//! Execute a claimed build task
+	void ExecuteBuildTask(const BuildTask &task);
+	//! Records the error of a failed build task
+	void SetBuildError(ErrorData error);
 
 	ClientContext &context;
 	const PhysicalWindow &op;
@@ -284,6 +301,14 @@ public:
 	bool external;
 	//! The current execution functions
 	Executors executors;
+	//! The build tasks that idle threads can help with (guarded by the built_lock of gsource)
+	vector<BuildTask> build_tasks;
+	//! The next build task to claim (guarded by the built_lock of gsource)
+	idx_t next_build_task;
+	//! The number of finished build tasks
+	atomic<idx_t> finished_build_tasks;
+	//! The first error of a build task (guarded by the built_lock of gsource)
+	ErrorData build_error;
 
 	//! The bin number
 	idx_t hash_bin;
@@ -413,6 +438,20 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
 		auto &order_mask = order_masks[wexpr.partitions.size() + wexpr.orders.size()];
 		auto wexec = WindowExecutorFactory(wexpr, context, partition_mask, order_mask, count, gstate.mode);
+		if (wexpr.type == ExpressionType::WINDOW_AGGREGATE) {
+			// aggregates over the same inputs (but possibly different frames) share a single aggregator
+			auto &aggr_exec = static_cast<WindowAggregateExecutor &>(*wexec);
+			for (idx_t prev_idx = 0; prev_idx < executors.size(); ++prev_idx) {
+				if (op.select_list[prev_idx]->type != ExpressionType::WINDOW_AGGREGATE) {
+					continue;
+				}
+				auto &prev_exec = static_cast<WindowAggregateExecutor &>(*executors[prev_idx]);
+				if (aggr_exec.CanShareAggregator(prev_exec)) {
+					aggr_exec.ShareAggregator(prev_exec);
+					break;
+				}
+			}
+		}
 		executors.emplace_back(std::move(wexec));
 	}
 
@@ -435,10 +474,21 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		input_idx += input_chunk.size();
 	}
 
-	//	TODO: Parallelization opportunity
-	for (auto &wexec : executors) {
-		wexec->Finalize();
+	//	Finalize the executors concurrently, then the tasks that complete them
+	vector<BuildTask> tasks;
+	for (idx_t expr_idx = 0; expr_idx < executors.size(); ++expr_idx) {
+		tasks.emplace_back(expr_idx, FINALIZE_EXECUTOR);
 	}
+	ExecuteBuildTasks(std::move(tasks));
+
+	tasks.clear();
+	for (idx_t expr_idx = 0; expr_idx < executors.size(); ++expr_idx) {
+		const auto task_count = executors[expr_idx]->GetFinalizeTasks();
+		for (idx_t task_idx = 0; task_idx < task_count; ++task_idx) {
+			tasks.emplace_back(expr_idx, task_idx);
+		}
+	}
+	ExecuteBuildTasks(std::move(tasks));
 
 	// External scanning assumes all blocks are swizzled.
 	scanner->ReSwizzle();
@@ -447,6 +497,108 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 	unscanned = rows->blocks.size();
 }
 
+void WindowPartitionSourceState::ExecuteBuildTasks(vector<BuildTask> tasks) {
+	if (tasks.empty()) {
+		return;
+	}
+	if (tasks.size() == 1) {
+		ExecuteBuildTask(tasks[0]);
+		return;
+	}
+
+	//	Publish the tasks so idle threads can claim them
+	{
+		lock_guard<mutex> built_guard(gsource.built_lock);
+		build_tasks = std::move(tasks);
+		next_build_task = 0;
+		finished_build_tasks = 0;
+		gsource.building.emplace_back(this);
+	}
+
+	while (true) {
+		BuildTask task;
+		{
+			lock_guard<mutex> built_guard(gsource.built_lock);
+			if (next_build_task >= build_tasks.size() || build_error.HasError()) {
+				break;
+			}
+			task = build_tasks[next_build_task++];
+		}
+		try {
+			ExecuteBuildTask(task);
+		} catch (...) {
+			//	The error is recorded: rethrow it once the other threads are done with this partition
+			break;
+		}
+	}
+
+	//	Stop handing out tasks, then wait for the tasks claimed by other threads
+	idx_t claimed_build_tasks;
+	{
+		lock_guard<mutex> built_guard(gsource.built_lock);
+		auto &building = gsource.building;
+		building.erase(std::find(building.begin(), building.end(), this));
+		claimed_build_tasks = next_build_task;
+	}
+	while (finished_build_tasks < claimed_build_tasks) {
+		TaskScheduler::YieldThread();
+	}
+
+	if (build_error.HasError()) {
+		build_error.Throw();
+	}
+}
+
+void WindowPartitionSourceState::ExecuteBuildTask(const BuildTask &task) {
+	auto &executor = *executors[task.first];
+	try {
+		if (task.second == FINALIZE_EXECUTOR) {
+			executor.Finalize();
+		} else {
+			executor.FinalizeTask(task.second);
+		}
+	} catch (std::exception &ex) {
+		SetBuildError(ErrorData(ex));
+		throw;
+	} catch (...) { // LCOV_EXCL_START
+		SetBuildError(ErrorData("Unknown exception while building a window partition"));
+		throw;
+	} // LCOV_EXCL_STOP
+	++finished_build_tasks;
+}
+
+void WindowPartitionSourceState::SetBuildError(ErrorData error) {
+	{
+		lock_guard<mutex> built_guard(gsource.built_lock);
+		if (!build_error.HasError()) {
+			build_error = std::move(error);
+		}
+	}
+	++finished_build_tasks;
+}
+
+bool WindowGlobalSourceState::HelpBuild() {
+	optional_ptr<WindowPartitionSourceState> partition_source;
+	WindowPartitionSourceState::BuildTask task;
+	{
+		//	Claiming under the lock keeps the partition alive until the task is finished
+		lock_guard<mutex> built_guard(built_lock);
+		for (auto building_source : building) {
+			if (building_source->next_build_task < building_source->build_tasks.size() &&
+			    !building_source->build_error.HasError()) {
+				partition_source = building_source;
+				task = building_source->build_tasks[building_source->next_build_task++];
+				break;
+			}
+		}
+	}
+	if (!partition_source) {
+		return false;
+	}
+	partition_source->ExecuteBuildTask(task);
+	return true;
+}
+
 // Per-thread scan state
 class WindowLocalSourceState : public LocalSourceState {
 public:
@@ -578,8 +730,10 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::NextTask(idx_t hash_bin)
 		}
 
 		//	If there is nothing to steal but there are unfinished partitions,
-		//	yield until any pending builds are done.
-		TaskScheduler::YieldThread();
+		//	help to finish any pending builds or yield until they are done.
+		if (!HelpBuild()) {
+			TaskScheduler::YieldThread();
+		}
 	}
 
 	return Task();
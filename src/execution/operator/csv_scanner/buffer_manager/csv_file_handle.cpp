@@ -46,6 +46,11 @@ idx_t CSVFileHandle::FileSize() {
 	return file_size;
 }
 
+time_t CSVFileHandle::GetLastModifiedTime() {
+	D_ASSERT(on_disk_file && can_seek);
+	return file_handle->file_system.GetLastModifiedTime(*file_handle);
+}
+
 bool CSVFileHandle::FinishedReading() {
 	return finished;
 }
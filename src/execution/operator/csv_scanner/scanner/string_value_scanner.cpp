@@ -5,6 +5,8 @@
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/common/operator/integer_cast_operator.hpp"
 #include "duckdb/common/operator/double_cast_operator.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include <algorithm>
 
 namespace duckdb {
@@ -45,9 +47,25 @@ StringValueResult::StringValueResult(CSVStates &states, CSVStateMachine &state_m
 			    "Mismatch between the number of columns (%d) in the CSV file and what is expected in the scanner (%d).",
 			    number_of_columns, csv_file_scan->file_types.size());
 		}
+		// With table filters, the columns that are not filtered on are parsed as VARCHAR: they are only cast when the
+		// chunk is flushed, for the rows that pass the filters
+		// NOTE: values that cannot be cast are therefore only reported for rows that pass the filters, while without
+		// filter pushdown they fail the scan in any row
+		vector<bool> filter_columns(csv_file_scan->file_types.size(), true);
+		auto &reader_data = csv_file_scan->reader_data;
+		if (reader_data.filters && !reader_data.filters->filters.empty() && !state_machine.options.ignore_errors) {
+			std::fill(filter_columns.begin(), filter_columns.end(), false);
+			for (auto &entry : reader_data.filters->filters) {
+				auto &filter_entry = reader_data.filter_map[entry.first];
+				if (!filter_entry.is_constant) {
+					filter_columns[csv_file_scan->GetParseColumn(filter_entry.index)] = true;
+				}
+			}
+		}
 		for (idx_t i = 0; i < csv_file_scan->file_types.size(); i++) {
 			auto &type = csv_file_scan->file_types[i];
-			if (StringValueScanner::CanDirectlyCast(type, state_machine.options.dialect_options.date_format)) {
+			if (filter_columns[i] &&
+			    StringValueScanner::CanDirectlyCast(type, state_machine.options.dialect_options.date_format)) {
 				parse_types[i] = type.id();
 				logical_types.emplace_back(type);
 			} else {
@@ -504,6 +522,95 @@ StringValueResult &StringValueScanner::ParseChunk() {
 	return result;
 }
 
+bool StringValueScanner::CastColumn(DataChunk &parse_chunk, idx_t col_idx, Vector &parse_vector, Vector &result_vector,
+                                    idx_t count, optional_ptr<SelectionVector> sel,
+                                    unordered_set<idx_t> &borked_lines) {
+	auto &type = result_vector.GetType();
+	auto &parse_type = parse_vector.GetType();
+	if (type == LogicalType::VARCHAR || (type != LogicalType::VARCHAR && parse_type != LogicalType::VARCHAR)) {
+		// reinterpret rather than reference
+		result_vector.Reinterpret(parse_vector);
+		return true;
+	}
+	string error_message;
+	bool success;
+	idx_t line_error = 0;
+	bool line_error_set = true;
+
+	if (!state_machine->options.dialect_options.date_format.at(LogicalTypeId::DATE).GetValue().Empty() &&
+	    type.id() == LogicalTypeId::DATE) {
+		// use the date format to cast the chunk
+		success = CSVCast::TryCastDateVector(state_machine->options.dialect_options.date_format, parse_vector,
+		                                     result_vector, count, error_message, line_error);
+	} else if (!state_machine->options.dialect_options.date_format.at(LogicalTypeId::TIMESTAMP)
+	                .GetValue()
+	                .Empty() &&
+	           type.id() == LogicalTypeId::TIMESTAMP) {
+		// use the date format to cast the chunk
+		success = CSVCast::TryCastTimestampVector(state_machine->options.dialect_options.date_format, parse_vector,
+		                                          result_vector, count, error_message);
+	} else if (state_machine->options.decimal_separator != "." &&
+	           (type.id() == LogicalTypeId::FLOAT || type.id() == LogicalTypeId::DOUBLE)) {
+		success = CSVCast::TryCastFloatingVectorCommaSeparated(state_machine->options, parse_vector, result_vector,
+		                                                       count, error_message, type, line_error);
+	} else if (state_machine->options.decimal_separator != "." && type.id() == LogicalTypeId::DECIMAL) {
+		success = CSVCast::TryCastDecimalVectorCommaSeparated(state_machine->options, parse_vector, result_vector,
+		                                                      count, error_message, type);
+	} else {
+		// target type is not varchar: perform a cast
+		success =
+		    VectorOperations::TryCast(buffer_manager->context, parse_vector, result_vector, count, &error_message);
+		line_error_set = false;
+	}
+	if (success) {
+		return true;
+	}
+	// An error happened, to propagate it we need to figure out the exact line where the casting failed.
+	UnifiedVectorFormat inserted_column_data;
+	result_vector.ToUnifiedFormat(count, inserted_column_data);
+	UnifiedVectorFormat parse_column_data;
+	parse_vector.ToUnifiedFormat(count, parse_column_data);
+	if (!line_error_set) {
+		for (; line_error < count; line_error++) {
+			if (!inserted_column_data.validity.RowIsValid(inserted_column_data.sel->get_index(line_error)) &&
+			    parse_column_data.validity.RowIsValid(parse_column_data.sel->get_index(line_error))) {
+				break;
+			}
+		}
+	}
+	{
+		// If the column was cast over a selection, the row in the parsed chunk is the selected one
+		auto row_idx = sel ? sel->get_index(line_error) : line_error;
+		vector<Value> row;
+		for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
+			row.push_back(parse_chunk.GetValue(col, row_idx));
+		}
+		auto csv_error =
+		    CSVError::CastError(state_machine->options, csv_file_scan->names[col_idx], error_message, col_idx, row);
+		LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(), lines_read - parse_chunk.size() + row_idx);
+		error_handler->Error(lines_per_batch, csv_error);
+	}
+	borked_lines.insert(line_error++);
+	D_ASSERT(state_machine->options.ignore_errors);
+	// We are ignoring errors. We must continue but ignoring borked rows
+	for (; line_error < count; line_error++) {
+		if (!inserted_column_data.validity.RowIsValid(inserted_column_data.sel->get_index(line_error)) &&
+		    parse_column_data.validity.RowIsValid(parse_column_data.sel->get_index(line_error))) {
+			borked_lines.insert(line_error);
+			auto row_idx = sel ? sel->get_index(line_error) : line_error;
+			vector<Value> row;
+			for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
+				row.push_back(parse_chunk.GetValue(col, row_idx));
+			}
+			auto csv_error = CSVError::CastError(state_machine->options, csv_file_scan->names[col_idx], error_message,
+			                                     col_idx, row);
+			LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(), lines_read - parse_chunk.size() + row_idx);
+			error_handler->Error(lines_per_batch, csv_error);
+		}
+	}
+	return false;
+}
+
 void StringValueScanner::Flush(DataChunk &insert_chunk) {
 	auto &process_result = ParseChunk();
 	// First Get Parsed Chunk
@@ -520,115 +627,128 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 	D_ASSERT(csv_file_scan);
 
 	auto &reader_data = csv_file_scan->reader_data;
-	// Now Do the cast-aroo
+	// Figure out the result column of every parsed column
+	vector<idx_t> result_columns(reader_data.column_ids.size());
 	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
-		idx_t col_idx = c;
-		idx_t result_idx = reader_data.column_mapping[c];
+		result_columns[c] = reader_data.column_mapping[c];
 		if (!csv_file_scan->projection_ids.empty()) {
-			result_idx = reader_data.column_mapping[csv_file_scan->projection_ids[c].second];
+			result_columns[c] = reader_data.column_mapping[csv_file_scan->projection_ids[c].second];
 		}
-		if (col_idx >= parse_chunk.ColumnCount()) {
+		if (c >= parse_chunk.ColumnCount()) {
 			throw InvalidInputException("Mismatch between the schema of different files");
 		}
-		auto &parse_vector = parse_chunk.data[col_idx];
-		auto &result_vector = insert_chunk.data[result_idx];
-		auto &type = result_vector.GetType();
-		auto &parse_type = parse_vector.GetType();
-		if (type == LogicalType::VARCHAR || (type != LogicalType::VARCHAR && parse_type != LogicalType::VARCHAR)) {
-			// reinterpret rather than reference
-			result_vector.Reinterpret(parse_vector);
-		} else {
-			string error_message;
-			bool success;
-			idx_t line_error = 0;
-			bool line_error_set = true;
+	}
 
-			if (!state_machine->options.dialect_options.date_format.at(LogicalTypeId::DATE).GetValue().Empty() &&
-			    type.id() == LogicalTypeId::DATE) {
-				// use the date format to cast the chunk
-				success = CSVCast::TryCastDateVector(state_machine->options.dialect_options.date_format, parse_vector,
-				                                     result_vector, parse_chunk.size(), error_message, line_error);
-			} else if (!state_machine->options.dialect_options.date_format.at(LogicalTypeId::TIMESTAMP)
-			                .GetValue()
-			                .Empty() &&
-			           type.id() == LogicalTypeId::TIMESTAMP) {
-				// use the date format to cast the chunk
-				success =
-				    CSVCast::TryCastTimestampVector(state_machine->options.dialect_options.date_format, parse_vector,
-				                                    result_vector, parse_chunk.size(), error_message);
-			} else if (state_machine->options.decimal_separator != "." &&
-			           (type.id() == LogicalTypeId::FLOAT || type.id() == LogicalTypeId::DOUBLE)) {
-				success =
-				    CSVCast::TryCastFloatingVectorCommaSeparated(state_machine->options, parse_vector, result_vector,
-				                                                 parse_chunk.size(), error_message, type, line_error);
-			} else if (state_machine->options.decimal_separator != "." && type.id() == LogicalTypeId::DECIMAL) {
-				success = CSVCast::TryCastDecimalVectorCommaSeparated(
-				    state_machine->options, parse_vector, result_vector, parse_chunk.size(), error_message, type);
-			} else {
-				// target type is not varchar: perform a cast
-				success = VectorOperations::TryCast(buffer_manager->context, parse_vector, result_vector,
-				                                    parse_chunk.size(), &error_message);
-				line_error_set = false;
+	auto filters = reader_data.filters;
+	if (!filters || filters->filters.empty()) {
+		// Now Do the cast-aroo
+		for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
+			CastColumn(parse_chunk, c, parse_chunk.data[c], insert_chunk.data[result_columns[c]], parse_chunk.size(),
+			           nullptr, borked_lines);
+		}
+		RemoveBorkedLines(insert_chunk, borked_lines);
+		return;
+	}
+
+	// We have table filters, we first cast the columns used in filters, and evaluate the filters over them.
+	// The remaining columns are only cast for the rows that pass the filters.
+	// If we are ignoring errors we cast everything upfront, since all errors must be reported.
+	vector<bool> cast_columns(reader_data.column_ids.size(), state_machine->options.ignore_errors);
+	for (auto &entry : filters->filters) {
+		auto &filter_entry = reader_data.filter_map[entry.first];
+		if (!filter_entry.is_constant) {
+			cast_columns[csv_file_scan->GetParseColumn(filter_entry.index)] = true;
+		}
+	}
+	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
+		if (cast_columns[c]) {
+			CastColumn(parse_chunk, c, parse_chunk.data[c], insert_chunk.data[result_columns[c]], parse_chunk.size(),
+			           nullptr, borked_lines);
+		}
+	}
+
+	// Rows that failed to cast are never part of the result
+	SelectionVector sel(parse_chunk.size());
+	idx_t approved_tuple_count = 0;
+	for (idx_t row_idx = 0; row_idx < parse_chunk.size(); row_idx++) {
+		if (borked_lines.find(row_idx) == borked_lines.end()) {
+			sel.set_index(approved_tuple_count++, row_idx);
+		}
+	}
+	borked_lines.clear();
+
+	for (auto &entry : filters->filters) {
+		if (approved_tuple_count == 0) {
+			// if no rows are left we can stop checking filters
+			break;
+		}
+		auto &filter_entry = reader_data.filter_map[entry.first];
+		if (filter_entry.is_constant) {
+			// this is a constant vector, the filter either passes for all rows or for none
+			Vector constant_vector(reader_data.constant_map[filter_entry.index].value);
+			constant_vector.Flatten(1);
+			SelectionVector constant_sel(1);
+			constant_sel.set_index(0, 0);
+			idx_t constant_count = 1;
+			ColumnSegment::FilterSelection(constant_sel, constant_vector, *entry.second, constant_count,
+			                               FlatVector::Validity(constant_vector));
+			if (constant_count == 0) {
+				approved_tuple_count = 0;
 			}
-			if (success) {
+			continue;
+		}
+		auto &result_vector = insert_chunk.data[result_columns[csv_file_scan->GetParseColumn(filter_entry.index)]];
+		result_vector.Flatten(parse_chunk.size());
+		ColumnSegment::FilterSelection(sel, result_vector, *entry.second, approved_tuple_count,
+		                               FlatVector::Validity(result_vector));
+	}
+
+	if (approved_tuple_count == 0) {
+		// No rows passed the filters, there is nothing left to cast
+		insert_chunk.SetCardinality(0);
+		return;
+	}
+	if (approved_tuple_count == parse_chunk.size()) {
+		// All rows passed, cast the remaining columns as usual
+		for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
+			if (cast_columns[c]) {
 				continue;
 			}
-			// An error happened, to propagate it we need to figure out the exact line where the casting failed.
-			UnifiedVectorFormat inserted_column_data;
-			result_vector.ToUnifiedFormat(parse_chunk.size(), inserted_column_data);
-			UnifiedVectorFormat parse_column_data;
-			parse_vector.ToUnifiedFormat(parse_chunk.size(), parse_column_data);
-			if (!line_error_set) {
-				for (; line_error < parse_chunk.size(); line_error++) {
-					if (!inserted_column_data.validity.RowIsValid(line_error) &&
-					    parse_column_data.validity.RowIsValid(line_error)) {
-						break;
-					}
-				}
-			}
-			{
-				vector<Value> row;
-				for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
-					row.push_back(parse_chunk.GetValue(col, line_error));
-				}
-				auto csv_error = CSVError::CastError(state_machine->options, csv_file_scan->names[col_idx],
-				                                     error_message, col_idx, row);
-				LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(),
-				                                 lines_read - parse_chunk.size() + line_error);
-				error_handler->Error(lines_per_batch, csv_error);
-			}
-			borked_lines.insert(line_error++);
-			D_ASSERT(state_machine->options.ignore_errors);
-			// We are ignoring errors. We must continue but ignoring borked rows
-			for (; line_error < parse_chunk.size(); line_error++) {
-				if (!inserted_column_data.validity.RowIsValid(line_error) &&
-				    parse_column_data.validity.RowIsValid(line_error)) {
-					borked_lines.insert(line_error);
-					vector<Value> row;
-					for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
-						row.push_back(parse_chunk.GetValue(col, line_error));
-					}
-					auto csv_error = CSVError::CastError(state_machine->options, csv_file_scan->names[col_idx],
-					                                     error_message, col_idx, row);
-					LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(),
-					                                 lines_read - parse_chunk.size() + line_error);
-					error_handler->Error(lines_per_batch, csv_error);
-				}
-			}
+			CastColumn(parse_chunk, c, parse_chunk.data[c], insert_chunk.data[result_columns[c]], parse_chunk.size(),
+			           nullptr, borked_lines);
 		}
+		RemoveBorkedLines(insert_chunk, borked_lines);
+		return;
 	}
-	if (!borked_lines.empty()) {
-		// We must remove the borked lines from our chunk
-		SelectionVector succesful_rows(parse_chunk.size() - borked_lines.size());
-		idx_t sel_idx = 0;
-		for (idx_t row_idx = 0; row_idx < parse_chunk.size(); row_idx++) {
-			if (borked_lines.find(row_idx) == borked_lines.end()) {
-				succesful_rows.set_index(sel_idx++, row_idx);
-			}
+
+	// Slice the already cast columns, and only cast the selected rows of the remaining ones
+	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
+		auto &result_vector = insert_chunk.data[result_columns[c]];
+		if (cast_columns[c]) {
+			result_vector.Slice(sel, approved_tuple_count);
+			continue;
+		}
+		Vector sliced_vector(parse_chunk.data[c], sel, approved_tuple_count);
+		CastColumn(parse_chunk, c, sliced_vector, result_vector, approved_tuple_count, &sel, borked_lines);
+	}
+	insert_chunk.SetCardinality(approved_tuple_count);
+	RemoveBorkedLines(insert_chunk, borked_lines);
+}
+
+void StringValueScanner::RemoveBorkedLines(DataChunk &insert_chunk, const unordered_set<idx_t> &borked_lines) {
+	if (borked_lines.empty()) {
+		return;
+	}
+	// We must remove the borked lines from our chunk
+	SelectionVector succesful_rows(insert_chunk.size() - borked_lines.size());
+	idx_t sel_idx = 0;
+	for (idx_t row_idx = 0; row_idx < insert_chunk.size(); row_idx++) {
+		if (borked_lines.find(row_idx) == borked_lines.end()) {
+			succesful_rows.set_index(sel_idx++, row_idx);
 		}
-		// Now we slice the result
-		insert_chunk.Slice(succesful_rows, sel_idx);
 	}
+	// Now we slice the result
+	insert_chunk.Slice(succesful_rows, sel_idx);
 }
 
 void StringValueScanner::Initialize() {
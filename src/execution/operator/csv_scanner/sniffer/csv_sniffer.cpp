@@ -1,4 +1,6 @@
 #include "duckdb/execution/operator/csv_scanner/sniffer/csv_sniffer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
 
 namespace duckdb {
 
@@ -82,7 +84,79 @@ void CSVSniffer::SetResultOptions() {
 	options.dialect_options.num_cols = best_candidate->GetStateMachine().dialect_options.num_cols;
 }
 
+string CSVSniffer::GetCacheKey() {
+	auto &context = buffer_manager->context;
+	if (!ObjectCache::ObjectCacheEnabled(context)) {
+		return string();
+	}
+	auto &file_handle = *buffer_manager->file_handle;
+	if (!file_handle.OnDiskFile() || !file_handle.CanSeek()) {
+		// we can't tell if pipes or compressed files have been modified
+		return string();
+	}
+	// The key holds the file and all options that can influence the result of the sniffer
+	MemoryStream stream;
+	BinarySerializer::Serialize(options, stream);
+	string key = "csv_sniffer:" + buffer_manager->GetFilePath() + ":";
+	key += string(const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	for (auto &type : options.sql_type_list) {
+		key += ":" + type.ToString();
+	}
+	for (auto &name : options.name_list) {
+		key += ":" + name;
+	}
+	for (auto &entry : options.sql_types_per_column) {
+		key += ":" + entry.first + "=" + to_string(entry.second);
+	}
+	for (auto &type : options.auto_type_candidates) {
+		key += ":" + type.ToString();
+	}
+	for (idx_t i = 0; i < set_columns.Size(); i++) {
+		key += ":" + (*set_columns.names)[i] + "=" + (*set_columns.types)[i].ToString();
+	}
+	return key;
+}
+
 SnifferResult CSVSniffer::SniffCSV(bool force_match) {
+	auto cache_key = GetCacheKey();
+	if (cache_key.empty()) {
+		return SniffCSVInternal(force_match);
+	}
+	auto &object_cache = ObjectCache::GetObjectCache(buffer_manager->context);
+	auto &file_handle = *buffer_manager->file_handle;
+	auto file_size = file_handle.FileSize();
+	auto last_modified = file_handle.GetLastModifiedTime();
+	auto entry = object_cache.Get<CSVSnifferCacheEntry>(cache_key);
+	// The modification time has a coarse granularity, so the file might have been rewritten without changing its size
+	// or modification time: re-validate the result against the first buffer, which we have to read anyway
+	auto first_buffer_hash = HashFirstBuffer();
+	if (entry && entry->IsValid(file_size, last_modified) && entry->first_buffer_hash == first_buffer_hash) {
+		// The file has been sniffed before with the same options
+		options.dialect_options = entry->dialect_options;
+		options.sniffer_user_mismatch_error = entry->sniffer_user_mismatch_error;
+		options.auto_detect = true;
+		if (!options.sniffer_user_mismatch_error.empty() && force_match) {
+			throw InvalidInputException(options.sniffer_user_mismatch_error);
+		}
+		return entry->result;
+	}
+	auto result = SniffCSVInternal(force_match);
+	object_cache.Put(cache_key, make_shared<CSVSnifferCacheEntry>(options.dialect_options,
+	                                                              options.sniffer_user_mismatch_error, result,
+	                                                              file_size, last_modified, first_buffer_hash));
+	return result;
+}
+
+hash_t CSVSniffer::HashFirstBuffer() {
+	auto buffer = buffer_manager->GetBuffer(0);
+	if (!buffer) {
+		// empty file
+		return 0;
+	}
+	return Hash(buffer->Ptr(), buffer->actual_size);
+}
+
+SnifferResult CSVSniffer::SniffCSVInternal(bool force_match) {
 	// 1. Dialect Detection
 	DetectDialect();
 	// 2. Type Detection
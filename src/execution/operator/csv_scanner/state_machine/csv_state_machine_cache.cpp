@@ -165,6 +165,13 @@ void CSVStateMachineCache::Insert(const CSVStateMachineOptions &state_machine_op
 	transition_array.skip_quoted[escape] = false;
 	transition_array.skip_quoted[static_cast<uint8_t>('\n')] = false;
 	transition_array.skip_quoted[static_cast<uint8_t>('\r')] = false;
+
+	// Broadcast the same characters, so that we can skip 8 bytes at a time
+	transition_array.delimiter = StateMachine::Broadcast(delimiter);
+	transition_array.new_line = StateMachine::Broadcast(static_cast<uint8_t>('\n'));
+	transition_array.carriage_return = StateMachine::Broadcast(static_cast<uint8_t>('\r'));
+	transition_array.quote = StateMachine::Broadcast(quote);
+	transition_array.escape = StateMachine::Broadcast(escape);
 }
 
 CSVStateMachineCache::CSVStateMachineCache() {
@@ -7,7 +7,7 @@ namespace duckdb {
 CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> buffer_manager_p,
                          shared_ptr<CSVStateMachine> state_machine_p, const CSVReaderOptions &options_p,
                          const ReadCSVData &bind_data, const vector<column_t> &column_ids,
-                         vector<LogicalType> &file_schema)
+                         optional_ptr<TableFilterSet> filters, vector<LogicalType> &file_schema)
     : file_path(options_p.file_path), file_idx(0), buffer_manager(std::move(buffer_manager_p)),
       state_machine(std::move(state_machine_p)), file_size(buffer_manager->file_handle->FileSize()),
       error_handler(make_shared<CSVErrorHandler>(options_p.ignore_errors)),
@@ -18,7 +18,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 		options = union_reader.options;
 		types = union_reader.GetTypes();
 		MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+		                                  bind_data.return_names, column_ids, filters, file_path, context);
 		InitializeFileNamesTypes();
 		return;
 	} else if (!bind_data.column_info.empty()) {
@@ -26,7 +26,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 		names = bind_data.column_info[0].names;
 		types = bind_data.column_info[0].types;
 		MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+		                                  bind_data.return_names, column_ids, filters, file_path, context);
 		InitializeFileNamesTypes();
 		return;
 	}
@@ -34,14 +34,14 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 	types = bind_data.return_types;
 	file_schema = bind_data.return_types;
 	MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-	                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+	                                  bind_data.return_names, column_ids, filters, file_path, context);
 
 	InitializeFileNamesTypes();
 }
 
 CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, const CSVReaderOptions &options_p,
                          const idx_t file_idx_p, const ReadCSVData &bind_data, const vector<column_t> &column_ids,
-                         const vector<LogicalType> &file_schema)
+                         optional_ptr<TableFilterSet> filters, const vector<LogicalType> &file_schema)
     : file_path(file_path_p), file_idx(file_idx_p),
       error_handler(make_shared<CSVErrorHandler>(options_p.ignore_errors)), options(options_p) {
 	if (file_idx < bind_data.union_readers.size()) {
@@ -64,7 +64,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 			types = union_reader.GetTypes();
 			state_machine = union_reader.state_machine;
 			MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind,
-			                                  bind_data.return_types, bind_data.return_names, column_ids, nullptr,
+			                                  bind_data.return_types, bind_data.return_names, column_ids, filters,
 			                                  file_path, context);
 
 			InitializeFileNamesTypes();
@@ -89,7 +89,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 		    state_machine_cache.Get(options.dialect_options.state_machine_options), options);
 
 		MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+		                                  bind_data.return_names, column_ids, filters, file_path, context);
 		InitializeFileNamesTypes();
 		return;
 	}
@@ -120,7 +120,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 	    make_shared<CSVStateMachine>(state_machine_cache.Get(options.dialect_options.state_machine_options), options);
 
 	MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-	                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+	                                  bind_data.return_names, column_ids, filters, file_path, context);
 	InitializeFileNamesTypes();
 }
 
@@ -202,6 +202,18 @@ void CSVFileScan::InitializeFileNamesTypes() {
 	file_types = sorted_types;
 }
 
+idx_t CSVFileScan::GetParseColumn(idx_t reader_idx) const {
+	if (projection_ids.empty()) {
+		return reader_idx;
+	}
+	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
+		if (projection_ids[c].second == reader_idx) {
+			return c;
+		}
+	}
+	throw InternalException("CSV Scanner: filter column is not part of the parsed columns");
+}
+
 const string &CSVFileScan::GetFileName() {
 	return file_path;
 }
@@ -20,6 +20,14 @@ PhysicalPiecewiseMergeJoin::PhysicalPiecewiseMergeJoin(LogicalComparisonJoin &op
     : PhysicalRangeJoin(op, PhysicalOperatorType::PIECEWISE_MERGE_JOIN, std::move(left), std::move(right),
                         std::move(cond), join_type, estimated_cardinality) {
 
+	// An equality is far more selective than a range, so merge on it if there is one
+	for (idx_t c = 0; c < conditions.size(); ++c) {
+		if (conditions[c].comparison == ExpressionType::COMPARE_EQUAL) {
+			std::swap(conditions[0], conditions[c]);
+			break;
+		}
+	}
+
 	for (auto &cond : conditions) {
 		D_ASSERT(cond.left->return_type == cond.right->return_type);
 		join_key_types.push_back(cond.left->return_type);
@@ -38,8 +46,17 @@ PhysicalPiecewiseMergeJoin::PhysicalPiecewiseMergeJoin(LogicalComparisonJoin &op
 			lhs_orders.emplace_back(OrderType::DESCENDING, OrderByNullType::NULLS_LAST, std::move(left));
 			rhs_orders.emplace_back(OrderType::DESCENDING, OrderByNullType::NULLS_LAST, std::move(right));
 			break;
+		case ExpressionType::COMPARE_EQUAL:
+			if (lhs_orders.empty()) {
+				// Equi-join: both sides are sorted on the key and the matching runs are merged
+				lhs_orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, std::move(left));
+				rhs_orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, std::move(right));
+				break;
+			}
+			DUCKDB_EXPLICIT_FALLTHROUGH;
 		case ExpressionType::COMPARE_NOTEQUAL:
 		case ExpressionType::COMPARE_DISTINCT_FROM:
+		case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
 			// Allowed in multi-predicate joins, but can't be first/sort.
 			D_ASSERT(!lhs_orders.empty());
 			lhs_orders.emplace_back(OrderType::INVALID, OrderByNullType::NULLS_LAST, std::move(left));
@@ -47,7 +64,6 @@ PhysicalPiecewiseMergeJoin::PhysicalPiecewiseMergeJoin(LogicalComparisonJoin &op
 			break;
 
 		default:
-			// COMPARE EQUAL not supported with merge join
 			throw NotImplementedException("Unimplemented join type for merge join");
 		}
 	}
@@ -83,6 +99,20 @@ public:
 		return table->count;
 	}
 
+	//! The first row of each sorted block (and the total count), used to seek into the sorted RHS
+	const vector<idx_t> &BlockStarts() {
+		lock_guard<mutex> guard(lock);
+		if (block_starts.empty()) {
+			idx_t start = 0;
+			for (idx_t block_idx = 0; block_idx < table->BlockCount(); ++block_idx) {
+				block_starts.emplace_back(start);
+				start += table->BlockSize(block_idx);
+			}
+			block_starts.emplace_back(start);
+		}
+		return block_starts;
+	}
+
 	void Sink(DataChunk &input, MergeJoinLocalState &lstate) {
 		auto &global_sort_state = table->global_sort_state;
 		auto &local_sort_state = lstate.table.local_sort_state;
@@ -97,6 +127,10 @@ public:
 	}
 
 	unique_ptr<GlobalSortedTable> table;
+
+private:
+	mutex lock;
+	vector<idx_t> block_starts;
 };
 
 unique_ptr<GlobalSinkState> PhysicalPiecewiseMergeJoin::GetGlobalSinkState(ClientContext &context) const {
@@ -307,6 +341,174 @@ static data_ptr_t MergeJoinRadixPtr(SBScanState &scan, const idx_t entry_idx) {
 	return scan.RadixPtr();
 }
 
+static int MergeJoinCompareEntries(SBScanState &lread, const idx_t l_entry_idx, SBScanState &rread,
+                                   const idx_t r_entry_idx, const SortLayout &sort_layout, const bool external) {
+	auto l_ptr = MergeJoinRadixPtr(lread, l_entry_idx);
+	auto r_ptr = MergeJoinRadixPtr(rread, r_entry_idx);
+	if (sort_layout.all_constant) {
+		return FastMemcmp(l_ptr, r_ptr, sort_layout.comparison_size);
+	}
+	return Comparators::CompareTuple(lread, rread, l_ptr, r_ptr, sort_layout, external);
+}
+
+//! Binary search the sorted RHS, starting at block r_block_idx, for the first entry that is not smaller than the LHS
+//! key at l_entry_idx. Returns false if there is no such entry, i.e., no equality match is possible.
+static bool MergeJoinSeekEqual(SBScanState &lread, const idx_t l_entry_idx, SBScanState &rread,
+                               MergeJoinGlobalState &rstate, idx_t &r_block_idx, idx_t &right_base,
+                               idx_t &r_entry_idx) {
+	auto &rsort = rstate.table->global_sort_state;
+	const auto &sort_layout = rsort.sort_layout;
+	const auto external = rsort.external;
+
+	const auto &block_starts = rstate.BlockStarts();
+	const auto block_count = block_starts.size() - 1;
+	const auto rhs_not_null = rstate.table->count - rstate.table->has_null;
+	auto block_not_null = [&](const idx_t block_idx) {
+		const auto start = block_starts[block_idx];
+		return SortedBlockNotNull(start, block_starts[block_idx + 1] - start, rhs_not_null);
+	};
+
+	// Find the first block whose largest key is not smaller than the LHS key (NULLs are at the end)
+	idx_t lo = MinValue(r_block_idx, block_count);
+	idx_t hi = block_count;
+	while (lo < hi) {
+		const auto mid = lo + (hi - lo) / 2;
+		const auto not_null = block_not_null(mid);
+		if (not_null) {
+			MergeJoinPinSortingBlock(rread, mid);
+		}
+		if (!not_null || MergeJoinCompareEntries(lread, l_entry_idx, rread, not_null - 1, sort_layout, external) <= 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	if (lo == block_count || !block_not_null(lo)) {
+		return false;
+	}
+	r_block_idx = lo;
+	right_base = block_starts[lo];
+
+	// Find the first entry in that block that is not smaller than the LHS key
+	MergeJoinPinSortingBlock(rread, r_block_idx);
+	lo = 0;
+	hi = block_not_null(r_block_idx);
+	while (lo < hi) {
+		const auto mid = lo + (hi - lo) / 2;
+		if (MergeJoinCompareEntries(lread, l_entry_idx, rread, mid, sort_layout, external) <= 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	r_entry_idx = lo;
+
+	return true;
+}
+
+//! Seeks the sorted RHS, starting at block r_block_idx, to the first entry that is not smaller than the LHS key at
+//! l_entry_idx
+static bool MergeJoinSeekEqual(PiecewiseMergeJoinState &lstate, MergeJoinGlobalState &rstate, const idx_t l_entry_idx,
+                               idx_t &r_block_idx, idx_t &right_base, idx_t &r_entry_idx) {
+	auto &lhs_table = *lstate.lhs_local_table;
+	if (lhs_table.count == lhs_table.has_null) {
+		return false;
+	}
+
+	auto &lsort = *lstate.lhs_global_state;
+	auto &rsort = rstate.table->global_sort_state;
+
+	D_ASSERT(lsort.sorted_blocks.size() == 1);
+	SBScanState lread(lsort.buffer_manager, lsort);
+	lread.sb = lsort.sorted_blocks[0].get();
+	MergeJoinPinSortingBlock(lread, 0);
+
+	D_ASSERT(rsort.sorted_blocks.size() == 1);
+	SBScanState rread(rsort.buffer_manager, rsort);
+	rread.sb = rsort.sorted_blocks[0].get();
+
+	return MergeJoinSeekEqual(lread, l_entry_idx, rread, rstate, r_block_idx, right_base, r_entry_idx);
+}
+
+//! Returns the first entry of the pinned RHS block, after r_entry_idx (which is smaller than the LHS key at
+//! l_entry_idx), that is not smaller than that LHS key. Galloping keeps this logarithmic in the distance skipped,
+//! so an LHS chunk whose keys are spread over the whole RHS does not step through all of it.
+static idx_t MergeJoinGallopEqual(SBScanState &lread, const idx_t l_entry_idx, SBScanState &rread, idx_t r_entry_idx,
+                                  const idx_t r_not_null, const SortLayout &sort_layout, const bool external) {
+	// Double the step until we pass the LHS key (or the end of the block)
+	idx_t step = 1;
+	idx_t hi = r_entry_idx + step;
+	while (hi < r_not_null && MergeJoinCompareEntries(lread, l_entry_idx, rread, hi, sort_layout, external) > 0) {
+		r_entry_idx = hi;
+		step *= 2;
+		hi = r_entry_idx + step;
+	}
+	// Then binary search the last step
+	idx_t lo = r_entry_idx + 1;
+	hi = MinValue(hi, r_not_null);
+	while (lo < hi) {
+		const auto mid = lo + (hi - lo) / 2;
+		if (MergeJoinCompareEntries(lread, l_entry_idx, rread, mid, sort_layout, external) <= 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	return lo;
+}
+
+static void MergeJoinSimpleEqual(PiecewiseMergeJoinState &lstate, MergeJoinGlobalState &rstate, bool *found_match) {
+	idx_t r_block_idx = 0;
+	idx_t right_base;
+	idx_t r_entry_idx;
+	if (!MergeJoinSeekEqual(lstate, rstate, 0, r_block_idx, right_base, r_entry_idx)) {
+		return;
+	}
+
+	auto &lsort = *lstate.lhs_global_state;
+	auto &rsort = rstate.table->global_sort_state;
+	const auto &sort_layout = lsort.sort_layout;
+	const auto external = lsort.external;
+
+	SBScanState lread(lsort.buffer_manager, lsort);
+	lread.sb = lsort.sorted_blocks[0].get();
+	MergeJoinPinSortingBlock(lread, 0);
+	idx_t l_entry_idx = 0;
+	const auto lhs_not_null = lstate.lhs_local_table->count - lstate.lhs_local_table->has_null;
+
+	SBScanState rread(rsort.buffer_manager, rsort);
+	rread.sb = rsort.sorted_blocks[0].get();
+	const auto rhs_not_null = rstate.table->count - rstate.table->has_null;
+
+	// Both sides are sorted, so a single merge pass marks every LHS key that occurs in the RHS
+	while (true) {
+		const auto r_count = rread.sb->radix_sorting_data[r_block_idx]->count;
+		const auto r_not_null = SortedBlockNotNull(right_base, r_count, rhs_not_null);
+
+		MergeJoinPinSortingBlock(rread, r_block_idx);
+		while (r_entry_idx < r_not_null) {
+			const auto comp_res =
+			    MergeJoinCompareEntries(lread, l_entry_idx, rread, r_entry_idx, sort_layout, external);
+			if (comp_res > 0) {
+				r_entry_idx =
+				    MergeJoinGallopEqual(lread, l_entry_idx, rread, r_entry_idx, r_not_null, sort_layout, external);
+				continue;
+			}
+			// The RHS key may also match the next LHS key, so only move the left side
+			if (comp_res == 0) {
+				found_match[l_entry_idx] = true;
+			}
+			if (++l_entry_idx >= lhs_not_null) {
+				return;
+			}
+		}
+		// The rest of the block is smaller than the LHS key: seek the block that can hold it
+		if (!MergeJoinSeekEqual(lread, l_entry_idx, rread, rstate, ++r_block_idx, right_base, r_entry_idx)) {
+			return;
+		}
+	}
+}
+
 static idx_t MergeJoinSimpleBlocks(PiecewiseMergeJoinState &lstate, MergeJoinGlobalState &rstate, bool *found_match,
                                    const ExpressionType comparison) {
 	const auto cmp = MergeJoinComparisonValue(comparison);
@@ -397,7 +599,11 @@ void PhysicalPiecewiseMergeJoin::ResolveSimpleJoin(ExecutionContext &context, Da
 	// perform the actual join
 	bool found_match[STANDARD_VECTOR_SIZE];
 	memset(found_match, 0, sizeof(found_match));
-	MergeJoinSimpleBlocks(state, gstate, found_match, conditions[0].comparison);
+	if (conditions[0].comparison == ExpressionType::COMPARE_EQUAL) {
+		MergeJoinSimpleEqual(state, gstate, found_match);
+	} else {
+		MergeJoinSimpleBlocks(state, gstate, found_match, conditions[0].comparison);
+	}
 
 	// use the sorted payload
 	const auto lhs_not_null = lhs_table.count - lhs_table.has_null;
@@ -524,6 +730,66 @@ static idx_t MergeJoinComplexBlocks(BlockMergeInfo &l, BlockMergeInfo &r, const
 	return result_count;
 }
 
+static idx_t MergeJoinComplexEqual(BlockMergeInfo &l, BlockMergeInfo &r, idx_t &left_cursor) {
+	D_ASSERT(l.state.sort_layout.all_constant == r.state.sort_layout.all_constant);
+	const auto &sort_layout = l.state.sort_layout;
+	D_ASSERT(l.state.external == r.state.external);
+	const auto external = l.state.external;
+
+	D_ASSERT(l.state.sorted_blocks.size() == 1);
+	SBScanState lread(l.state.buffer_manager, l.state);
+	lread.sb = l.state.sorted_blocks[0].get();
+	D_ASSERT(lread.sb->radix_sorting_data.size() == 1);
+	MergeJoinPinSortingBlock(lread, l.block_idx);
+
+	D_ASSERT(r.state.sorted_blocks.size() == 1);
+	SBScanState rread(r.state.buffer_manager, r.state);
+	rread.sb = r.state.sorted_blocks[0].get();
+
+	if (r.entry_idx >= r.not_null) {
+		return 0;
+	}
+	MergeJoinPinSortingBlock(rread, r.block_idx);
+
+	// l.entry_idx is the first LHS key that is not smaller than the current RHS key,
+	// left_cursor is the next LHS entry of that run to pair with the current RHS entry
+	idx_t result_count = 0;
+	while (r.entry_idx < r.not_null && l.entry_idx < l.not_null) {
+		const auto comp_res = MergeJoinCompareEntries(lread, l.entry_idx, rread, r.entry_idx, sort_layout, external);
+		if (comp_res < 0) {
+			l.entry_idx++;
+			continue;
+		}
+		if (comp_res > 0) {
+			r.entry_idx =
+			    MergeJoinGallopEqual(lread, l.entry_idx, rread, r.entry_idx, r.not_null, sort_layout, external);
+			left_cursor = l.entry_idx;
+			continue;
+		}
+
+		left_cursor = MaxValue(left_cursor, l.entry_idx);
+		if (left_cursor < l.not_null &&
+		    (left_cursor == l.entry_idx ||
+		     MergeJoinCompareEntries(lread, left_cursor, rread, r.entry_idx, sort_layout, external) == 0)) {
+			l.result.set_index(result_count, sel_t(left_cursor));
+			r.result.set_index(result_count, sel_t(r.entry_idx));
+			result_count++;
+			left_cursor++;
+			if (result_count == STANDARD_VECTOR_SIZE) {
+				// out of space!
+				break;
+			}
+			continue;
+		}
+
+		// End of the LHS run: the next RHS entry may be a duplicate that matches the same run
+		r.entry_idx++;
+		left_cursor = l.entry_idx;
+	}
+
+	return result_count;
+}
+
 OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionContext &context, DataChunk &input,
                                                                   DataChunk &chunk, OperatorState &state_p) const {
 	auto &state = state_p.Cast<PiecewiseMergeJoinState>();
@@ -544,6 +810,11 @@ OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionConte
 			state.right_position = 0;
 			state.first_fetch = false;
 			state.finished = false;
+			if (conditions[0].comparison == ExpressionType::COMPARE_EQUAL) {
+				// Skip the RHS blocks that are all smaller than the LHS keys
+				state.finished = !MergeJoinSeekEqual(state, gstate, 0, state.right_chunk_index, state.right_base,
+				                                     state.right_position);
+			}
 		}
 		if (state.finished) {
 			if (state.left_outer.Enabled()) {
@@ -567,12 +838,32 @@ OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionConte
 		BlockMergeInfo right_info(gstate.table->global_sort_state, state.right_chunk_index, state.right_position,
 		                          rhs_not_null);
 
-		idx_t result_count =
-		    MergeJoinComplexBlocks(left_info, right_info, conditions[0].comparison, state.prev_left_index);
+		const auto equality = (conditions[0].comparison == ExpressionType::COMPARE_EQUAL);
+		idx_t result_count;
+		if (equality) {
+			result_count = MergeJoinComplexEqual(left_info, right_info, state.prev_left_index);
+		} else {
+			result_count =
+			    MergeJoinComplexBlocks(left_info, right_info, conditions[0].comparison, state.prev_left_index);
+		}
 		if (result_count == 0) {
+			if (equality) {
+				// the merge continues from the same LHS position in the right chunk that can hold its key,
+				// unless the LHS (or the non-NULL part of the RHS) is exhausted
+				state.prev_left_index = state.left_position;
+				if (state.left_position >= lhs_not_null || rhs_not_null < rblock.count) {
+					state.finished = true;
+					continue;
+				}
+				state.right_chunk_index++;
+				state.finished = !MergeJoinSeekEqual(state, gstate, state.left_position, state.right_chunk_index,
+				                                     state.right_base, state.right_position);
+				continue;
+			} else {
+				state.left_position = 0;
+			}
 			// exhausted this chunk on the right side
 			// move to the next right chunk
-			state.left_position = 0;
 			state.right_position = 0;
 			state.right_base += rsorted.radix_sorting_data[state.right_chunk_index]->count;
 			state.right_chunk_index++;
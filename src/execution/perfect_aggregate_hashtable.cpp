@@ -24,26 +24,36 @@ PerfectAggregateHashTable::PerfectAggregateHashTable(ClientContext &context, All
 	layout.Initialize(std::move(aggregate_objects_p));
 	tuple_size = layout.GetRowWidth();
 
-	// allocate and null initialize the data
-	owned_data = make_unsafe_uniq_array<data_t>(tuple_size * total_groups);
-	data = owned_data.get();
+	// the pages are allocated (and their states initialized) once a group in them is set
+	page_bits = MinValue<idx_t>(total_required_bits, PAGE_BITS);
+	pages.resize(total_groups >> page_bits);
+	group_is_set.resize(pages.size());
+}
+
+void PerfectAggregateHashTable::InitializePage(idx_t page_idx) {
+	D_ASSERT(!pages[page_idx]);
+	const idx_t page_size = idx_t(1) << page_bits;
 
-	// set up the empty payloads for every tuple, and initialize the "occupied" flag to false
-	group_is_set = make_unsafe_uniq_array<bool>(total_groups);
-	memset(group_is_set.get(), 0, total_groups * sizeof(bool));
+	// allocate the data, and initialize the "occupied" flag to false
+	pages[page_idx] = make_unsafe_uniq_array<data_t>(tuple_size * page_size);
+	group_is_set[page_idx] = make_unsafe_uniq_array<bool>(page_size);
+	memset(group_is_set[page_idx].get(), 0, page_size * sizeof(bool));
 
 	// initialize the hash table for each entry
-	auto address_data = FlatVector::GetData<uintptr_t>(addresses);
+	Vector page_addresses(LogicalType::POINTER);
+	auto address_data = FlatVector::GetData<uintptr_t>(page_addresses);
+	auto page_data = pages[page_idx].get();
 	idx_t init_count = 0;
-	for (idx_t i = 0; i < total_groups; i++) {
-		address_data[init_count] = uintptr_t(data) + (tuple_size * i);
+	for (idx_t i = 0; i < page_size; i++) {
+		address_data[init_count] = uintptr_t(page_data) + (tuple_size * i);
 		init_count++;
 		if (init_count == STANDARD_VECTOR_SIZE) {
-			RowOperations::InitializeStates(layout, addresses, *FlatVector::IncrementalSelectionVector(), init_count);
+			RowOperations::InitializeStates(layout, page_addresses, *FlatVector::IncrementalSelectionVector(),
+			                                init_count);
 			init_count = 0;
 		}
 	}
-	RowOperations::InitializeStates(layout, addresses, *FlatVector::IncrementalSelectionVector(), init_count);
+	RowOperations::InitializeStates(layout, page_addresses, *FlatVector::IncrementalSelectionVector(), init_count);
 }
 
 PerfectAggregateHashTable::~PerfectAggregateHashTable() {
@@ -126,12 +136,18 @@ void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload)
 		ComputeGroupLocation(groups.data[i], group_minima[i], address_data, current_shift, groups.size());
 	}
 	// now we have the HT entry number for every tuple
-	// compute the actual pointer to the data by adding it to the base HT pointer and multiplying by the tuple size
+	// compute the actual pointer to the data by adding the offset within its page to the page pointer
+	const idx_t page_mask = (idx_t(1) << page_bits) - 1;
 	for (idx_t i = 0; i < groups.size(); i++) {
 		const auto group = address_data[i];
 		D_ASSERT(group < total_groups);
-		group_is_set[group] = true;
-		address_data[i] = uintptr_t(data) + group * tuple_size;
+		const auto page_idx = group >> page_bits;
+		if (!pages[page_idx]) {
+			InitializePage(page_idx);
+		}
+		const auto entry_idx = group & page_mask;
+		group_is_set[page_idx][entry_idx] = true;
+		address_data[i] = uintptr_t(pages[page_idx].get()) + entry_idx * tuple_size;
 	}
 
 	// after finding the group location we update the aggregates
@@ -154,24 +170,44 @@ void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload)
 }
 
 void PerfectAggregateHashTable::Combine(PerfectAggregateHashTable &other) {
+	for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+		CombinePage(other, page_idx);
+	}
+	TakeAllocators(other);
+}
+
+void PerfectAggregateHashTable::CombinePage(PerfectAggregateHashTable &other, idx_t page_idx) {
 	D_ASSERT(total_groups == other.total_groups);
 	D_ASSERT(tuple_size == other.tuple_size);
+	if (!other.pages[page_idx]) {
+		// the source has no entries in this page
+		return;
+	}
+	if (!pages[page_idx]) {
+		// we have no entries in this page: we can just take over the page of the source
+		pages[page_idx] = std::move(other.pages[page_idx]);
+		group_is_set[page_idx] = std::move(other.group_is_set[page_idx]);
+		return;
+	}
 
 	Vector source_addresses(LogicalType::POINTER);
 	Vector target_addresses(LogicalType::POINTER);
 	auto source_addresses_ptr = FlatVector::GetData<data_ptr_t>(source_addresses);
 	auto target_addresses_ptr = FlatVector::GetData<data_ptr_t>(target_addresses);
 
-	// iterate over all entries of both hash tables and call combine for all entries that can be combined
-	data_ptr_t source_ptr = other.data;
-	data_ptr_t target_ptr = data;
+	// iterate over all entries of the page in both hash tables and call combine for all entries that can be combined
+	auto source_is_set = other.group_is_set[page_idx].get();
+	auto target_is_set = group_is_set[page_idx].get();
+	data_ptr_t source_ptr = other.pages[page_idx].get();
+	data_ptr_t target_ptr = pages[page_idx].get();
 	idx_t combine_count = 0;
-	RowOperationsState row_state(*aggregate_allocator);
-	for (idx_t i = 0; i < total_groups; i++) {
-		auto has_entry_source = other.group_is_set[i];
+	// the allocator of the source is used, so pages can be combined concurrently (it is taken over afterwards)
+	RowOperationsState row_state(*other.aggregate_allocator);
+	const idx_t page_size = idx_t(1) << page_bits;
+	for (idx_t i = 0; i < page_size; i++) {
 		// we only have any work to do if the source has an entry for this group
-		if (has_entry_source) {
-			group_is_set[i] = true;
+		if (source_is_set[i]) {
+			target_is_set[i] = true;
 			source_addresses_ptr[combine_count] = source_ptr;
 			target_addresses_ptr[combine_count] = target_ptr;
 			combine_count++;
@@ -184,11 +220,17 @@ void PerfectAggregateHashTable::Combine(PerfectAggregateHashTable &other) {
 		target_ptr += tuple_size;
 	}
 	RowOperations::CombineStates(row_state, layout, source_addresses, target_addresses, combine_count);
+}
 
+void PerfectAggregateHashTable::TakeAllocators(PerfectAggregateHashTable &other) {
 	// FIXME: after moving the arena allocator, we currently have to ensure that the pointer is not nullptr, because the
 	// FIXME: Destroy()-function of the hash table expects an allocator in some cases (e.g., for sorted aggregates)
 	stored_allocators.push_back(std::move(other.aggregate_allocator));
 	other.aggregate_allocator = make_uniq<ArenaAllocator>(allocator);
+	for (auto &stored_allocator : other.stored_allocators) {
+		stored_allocators.push_back(std::move(stored_allocator));
+	}
+	other.stored_allocators.clear();
 }
 
 template <class T>
@@ -250,10 +292,18 @@ void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 
 	// iterate over the HT until we either have exhausted the entire HT, or
 	idx_t entry_count = 0;
+	const idx_t page_mask = (idx_t(1) << page_bits) - 1;
 	for (; scan_position < total_groups; scan_position++) {
-		if (group_is_set[scan_position]) {
+		const auto page_idx = scan_position >> page_bits;
+		if (!pages[page_idx]) {
+			// no groups are set in this page: skip to the last group of the page
+			scan_position |= page_mask;
+			continue;
+		}
+		const auto entry_idx = scan_position & page_mask;
+		if (group_is_set[page_idx][entry_idx]) {
 			// this group is set: add it to the set of groups to extract
-			data_pointers[entry_count] = data + tuple_size * scan_position;
+			data_pointers[entry_count] = pages[page_idx].get() + tuple_size * entry_idx;
 			group_values[entry_count] = scan_position;
 			entry_count++;
 			if (entry_count == STANDARD_VECTOR_SIZE) {
@@ -296,14 +346,20 @@ void PerfectAggregateHashTable::Destroy() {
 
 	// iterate over all initialised slots of the hash table
 	RowOperationsState row_state(*aggregate_allocator);
-	data_ptr_t payload_ptr = data;
-	for (idx_t i = 0; i < total_groups; i++) {
-		data_pointers[count++] = payload_ptr;
-		if (count == STANDARD_VECTOR_SIZE) {
-			RowOperations::DestroyStates(row_state, layout, addresses, count);
-			count = 0;
+	const idx_t page_size = idx_t(1) << page_bits;
+	for (auto &page : pages) {
+		if (!page) {
+			continue;
+		}
+		data_ptr_t payload_ptr = page.get();
+		for (idx_t i = 0; i < page_size; i++) {
+			data_pointers[count++] = payload_ptr;
+			if (count == STANDARD_VECTOR_SIZE) {
+				RowOperations::DestroyStates(row_state, layout, addresses, count);
+				count = 0;
+			}
+			payload_ptr += tuple_size;
 		}
-		payload_ptr += tuple_size;
 	}
 	RowOperations::DestroyStates(row_state, layout, addresses, count);
 }
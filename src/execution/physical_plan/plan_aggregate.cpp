@@ -2,15 +2,20 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
+#include "duckdb/execution/operator/order/physical_top_n.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -28,6 +33,20 @@ hugeint_t GetRangeHugeint(const BaseStatistics &nstats) {
 	return Hugeint::Convert(NumericStats::GetMax<T>(nstats)) - Hugeint::Convert(NumericStats::GetMin<T>(nstats));
 }
 
+//! Returns the value of an ENUM (i.e., the index in its dictionary) as a numeric value of the same physical type
+static Value GetEnumIndexValue(const LogicalType &enum_type, idx_t index) {
+	switch (enum_type.InternalType()) {
+	case PhysicalType::UINT8:
+		return Value::UTINYINT(uint8_t(index));
+	case PhysicalType::UINT16:
+		return Value::USMALLINT(uint16_t(index));
+	case PhysicalType::UINT32:
+		return Value::UINTEGER(uint32_t(index));
+	default:
+		throw InternalException("Unsupported physical type for ENUM");
+	}
+}
+
 static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate &op, vector<idx_t> &bits_per_group) {
 	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
 		return false;
@@ -56,6 +75,12 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		}
 		// check if the group has stats available
 		auto &group_type = group->return_type;
+		if (!stats && group_type.id() == LogicalTypeId::ENUM && EnumType::GetSize(group_type) > 0) {
+			// no stats, but the values of an ENUM are indexes in its dictionary: the dictionary bounds the domain
+			stats = NumericStats::CreateUnknown(group_type).ToUnique();
+			NumericStats::SetMin(*stats, GetEnumIndexValue(group_type, 0));
+			NumericStats::SetMax(*stats, GetEnumIndexValue(group_type, EnumType::GetSize(group_type) - 1));
+		}
 		if (!stats) {
 			// no stats, but we might still be able to use perfect hashing if the type is small enough
 			// for small types we can just set the stats to [type_min, type_max]
@@ -149,11 +174,133 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Whether the aggregate can be computed by a PhysicalStreamingAggregate, given input that is sorted on the groups
+static bool CanUseStreamingAggregate(LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Holistic aggregates (e.g., quantile or list) keep all of their input in states that are not buffer managed.
+//! If that input does not fit in memory, we sort on the groups instead (which can spill to disk),
+//! so that only the states of a single group have to be kept around at any time
+static bool CanUseSortedAggregate(ClientContext &context, LogicalAggregate &op, PhysicalOperator &child) {
+	if (!CanUseStreamingAggregate(op)) {
+		return false;
+	}
+	idx_t state_width = 0;
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.function.state_growth != AggregateStateGrowth::UNBOUNDED) {
+			continue;
+		}
+		for (auto &aggr_child : aggregate.children) {
+			state_width += GetTypeIdSize(aggr_child->return_type.InternalType());
+		}
+	}
+	if (state_width == 0) {
+		return false;
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	auto estimated_state_size = double(child.estimated_cardinality) * double(state_width);
+	return estimated_state_size > double(buffer_manager.GetQueryMaxMemory());
+}
+
+//! Whether the first key_count keys of the orders are (injective functions of) exactly the given columns
+static bool HasLeadingKeys(const vector<BoundOrderByNode> &orders, const set<idx_t> &columns, idx_t key_count) {
+	if (key_count > orders.size()) {
+		return false;
+	}
+	set<idx_t> key_columns;
+	for (idx_t key_idx = 0; key_idx < key_count; key_idx++) {
+		auto input_column = PhysicalPlanGenerator::GetOrderPreservingColumn(*orders[key_idx].expression);
+		if (!input_column.IsValid()) {
+			return false;
+		}
+		key_columns.insert(input_column.GetIndex());
+	}
+	return key_columns == columns;
+}
+
+//! Whether the output of the plan is sorted on the groups, i.e., whether the groups are the leading keys of an
+//! ORDER BY below the plan. We only look through operators that preserve the order of their input
+static bool IsSortedOnGroups(PhysicalOperator &plan, const vector<unique_ptr<Expression>> &groups) {
+	// the columns of the groups in the output of the current operator
+	vector<idx_t> columns;
+	for (auto &group : groups) {
+		if (group->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		columns.push_back(group->Cast<BoundReferenceExpression>().index);
+	}
+	reference<PhysicalOperator> current(plan);
+	while (true) {
+		auto &op = current.get();
+		switch (op.type) {
+		case PhysicalOperatorType::PROJECTION: {
+			auto &projection = op.Cast<PhysicalProjection>();
+			for (auto &column : columns) {
+				auto input_column = PhysicalPlanGenerator::GetOrderPreservingColumn(*projection.select_list[column]);
+				if (!input_column.IsValid()) {
+					return false;
+				}
+				column = input_column.GetIndex();
+			}
+			break;
+		}
+		case PhysicalOperatorType::FILTER:
+			break;
+		case PhysicalOperatorType::ORDER_BY: {
+			auto &order = op.Cast<PhysicalOrder>();
+			set<idx_t> group_columns;
+			for (auto &column : columns) {
+				group_columns.insert(order.projections[column]);
+			}
+			return HasLeadingKeys(order.orders, group_columns, columns.size());
+		}
+		case PhysicalOperatorType::TOP_N: {
+			auto &top_n = op.Cast<PhysicalTopN>();
+			set<idx_t> group_columns(columns.begin(), columns.end());
+			return HasLeadingKeys(top_n.orders, group_columns, columns.size());
+		}
+		default:
+			return false;
+		}
+		D_ASSERT(op.children.size() == 1);
+		current = *op.children[0];
+	}
+}
+
+//! The streaming aggregate runs on a single thread, while the hash aggregate runs in parallel. With several threads
+//! we only stream input that is sorted on the groups if the hash table could exceed the memory limit
+static bool PreferStreamingAggregate(ClientContext &context, LogicalAggregate &op, PhysicalOperator &child) {
+	if (TaskScheduler::GetScheduler(context).NumberOfThreads() == 1) {
+		return true;
+	}
+	idx_t row_width = 0;
+	for (auto &type : op.types) {
+		row_width += GetTypeIdSize(type.InternalType());
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	// every input row could be a separate group
+	auto estimated_table_size = double(child.estimated_cardinality) * double(row_width);
+	return estimated_table_size > double(buffer_manager.GetQueryMaxMemory());
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
 	auto plan = CreatePlan(*op.children[0]);
+	// check this before binding sorted aggregates, as these hide the state growth of the aggregate they wrap
+	bool use_sorted_aggregate = CanUseSortedAggregate(context, op, *plan);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
 
@@ -180,7 +327,28 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		// groups! create a GROUP BY aggregator
 		// use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (use_sorted_aggregate) {
+			// sort the input on the groups (the first columns of the projection) and aggregate one group at a time
+			vector<BoundOrderByNode> orders;
+			vector<idx_t> projections;
+			for (auto &group : op.groups) {
+				orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, group->Copy());
+			}
+			for (idx_t i = 0; i < plan->types.size(); i++) {
+				projections.push_back(i);
+			}
+			auto order = make_uniq<PhysicalOrder>(plan->types, std::move(orders), std::move(projections),
+			                                      plan->estimated_cardinality);
+			order->children.push_back(std::move(plan));
+			plan = std::move(order);
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.groups), std::move(op.expressions), op.estimated_cardinality);
+		} else if (CanUseStreamingAggregate(op) && IsSortedOnGroups(*plan, op.groups) &&
+		           PreferStreamingAggregate(context, op, *plan)) {
+			// the input is already sorted on the groups: aggregate one group at a time
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.groups), std::move(op.expressions), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -4,14 +4,19 @@
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
@@ -129,6 +134,142 @@ static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RewriteJoinCondition(child, offset); });
 }
 
+optional_idx PhysicalPlanGenerator::GetOrderPreservingColumn(const Expression &expr) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		return expr.Cast<BoundReferenceExpression>().index;
+	}
+	if (expr.type != ExpressionType::BOUND_FUNCTION) {
+		return optional_idx();
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (!StringUtil::StartsWith(func.function.name, "__internal_compress") &&
+	    !StringUtil::StartsWith(func.function.name, "__internal_decompress")) {
+		return optional_idx();
+	}
+	if (func.children.empty() || func.children[0]->type != ExpressionType::BOUND_REF) {
+		return optional_idx();
+	}
+	return func.children[0]->Cast<BoundReferenceExpression>().index;
+}
+
+//! Whether the rows produced by the operator are (already) sorted on the given column
+static bool IsOrderedOn(LogicalOperator &op, idx_t column) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto input_column = PhysicalPlanGenerator::GetOrderPreservingColumn(*op.expressions[column]);
+		if (!input_column.IsValid()) {
+			return false;
+		}
+		return IsOrderedOn(*op.children[0], input_column.GetIndex());
+	}
+	case LogicalOperatorType::LOGICAL_FILTER: {
+		// Filters preserve the order of their input
+		auto &filter = op.Cast<LogicalFilter>();
+		return IsOrderedOn(*op.children[0], filter.projection_map.empty() ? column : filter.projection_map[column]);
+	}
+	case LogicalOperatorType::LOGICAL_ORDER_BY: {
+		auto &order = op.Cast<LogicalOrder>();
+		auto &expr = *order.orders[0].expression;
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		const auto input_column = order.projections.empty() ? column : order.projections[column];
+		return expr.Cast<BoundReferenceExpression>().index == input_column;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Whether an equi-join can be executed as a merge join on one of its equality predicates
+static bool CanMergeEquality(LogicalComparisonJoin &op) {
+	switch (op.join_type) {
+	case JoinType::INNER:
+	case JoinType::LEFT:
+	case JoinType::RIGHT:
+	case JoinType::OUTER:
+		break;
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+	case JoinType::MARK:
+		if (op.conditions.size() != 1) {
+			return false;
+		}
+		break;
+	default:
+		return false;
+	}
+	bool has_equal = false;
+	for (auto &cond : op.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			continue;
+		}
+		// Only merge on keys whose sort order is consistent with equality
+		if (cond.left->return_type.IsNested()) {
+			return false;
+		}
+		has_equal = true;
+	}
+	return has_equal;
+}
+
+//! The estimated size of the rows of the operator, if they are materialized (e.g., in a hash table or a sort)
+static double EstimatedDataSize(LogicalOperator &op, idx_t cardinality) {
+	double row_width = sizeof(hash_t);
+	for (auto &type : op.types) {
+		row_width += double(GetTypeIdSize(type.InternalType()));
+	}
+	return double(cardinality) * row_width;
+}
+
+//! The equality condition that the merge join merges on (see PhysicalPiecewiseMergeJoin)
+static JoinCondition &MergeCondition(LogicalComparisonJoin &op) {
+	for (auto &cond : op.conditions) {
+		if (cond.comparison == ExpressionType::COMPARE_EQUAL) {
+			return cond;
+		}
+	}
+	throw InternalException("Merge equi-join without an equality condition");
+}
+
+//! Whether to use a merge join instead of a hash join for an equi-join.
+//! If sort_left is set, the left input has to be sorted on the merge key first.
+static bool PreferMergeJoin(ClientContext &context, LogicalComparisonJoin &op, idx_t lhs_cardinality,
+                            idx_t rhs_cardinality, bool &sort_left) {
+	sort_left = false;
+	if (!CanMergeEquality(op)) {
+		return false;
+	}
+	if (ClientConfig::GetConfig(context).prefer_merge_joins) {
+		return true;
+	}
+
+	// Both inputs are already sorted on an equality key: sorting them again is cheap
+	for (auto &cond : op.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL || cond.left->type != ExpressionType::BOUND_REF ||
+		    cond.right->type != ExpressionType::BOUND_REF) {
+			continue;
+		}
+		if (IsOrderedOn(*op.children[0], cond.left->Cast<BoundReferenceExpression>().index) &&
+		    IsOrderedOn(*op.children[1], cond.right->Cast<BoundReferenceExpression>().index)) {
+			return true;
+		}
+	}
+
+	// Both inputs are larger than the memory limit: the hash join would partition and spill both of them.
+	// Instead, we sort both of them out-of-core and merge them, which reads the sorted right side sequentially
+	// because every chunk of the sorted left side covers a narrow range of keys.
+	const auto max_memory = double(BufferManager::GetBufferManager(context).GetMaxMemory());
+	if (EstimatedDataSize(*op.children[0], lhs_cardinality) <= max_memory ||
+	    EstimatedDataSize(*op.children[1], rhs_cardinality) <= max_memory) {
+		return false;
+	}
+	auto &merge_key = *MergeCondition(op).left;
+	sort_left = merge_key.type != ExpressionType::BOUND_REF ||
+	            !IsOrderedOn(*op.children[0], merge_key.Cast<BoundReferenceExpression>().index);
+	return true;
+}
+
 bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &range_count) {
 	for (size_t c = 0; c < conds.size(); ++c) {
 		auto &cond = conds[c];
@@ -157,6 +298,9 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 	D_ASSERT(op.children.size() == 2);
 	idx_t lhs_cardinality = op.children[0]->EstimateCardinality(context);
 	idx_t rhs_cardinality = op.children[1]->EstimateCardinality(context);
+	// check the order of the inputs before planning them, planning moves the expressions out of the children
+	bool sort_left;
+	const bool prefer_merge_join = PreferMergeJoin(context, op, lhs_cardinality, rhs_cardinality, sort_left);
 	auto left = CreatePlan(*op.children[0]);
 	auto right = CreatePlan(*op.children[1]);
 	left->estimated_cardinality = lhs_cardinality;
@@ -189,7 +333,23 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 	const auto prefer_range_joins = (ClientConfig::GetConfig(context).prefer_range_joins && can_iejoin);
 
 	unique_ptr<PhysicalOperator> plan;
-	if (has_equality && !prefer_range_joins) {
+	if (has_equality && !prefer_range_joins && prefer_merge_join) {
+		// Equality join on sorted or very large inputs: sort (out-of-core) and merge
+		if (sort_left) {
+			vector<BoundOrderByNode> orders;
+			orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, MergeCondition(op).left->Copy());
+			vector<idx_t> projections;
+			for (idx_t i = 0; i < left->types.size(); i++) {
+				projections.push_back(i);
+			}
+			auto order = make_uniq<PhysicalOrder>(left->types, std::move(orders), std::move(projections),
+			                                      lhs_cardinality);
+			order->children.push_back(std::move(left));
+			left = std::move(order);
+		}
+		plan = make_uniq<PhysicalPiecewiseMergeJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
+		                                             op.join_type, op.estimated_cardinality);
+	} else if (has_equality && !prefer_range_joins) {
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
@@ -422,6 +422,18 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 
 void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
                                      DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
+	SinkInternal(context, chunk, input, payload_input, filter, nullptr);
+}
+
+void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
+                                     DataChunk &payload_input, const unsafe_vector<idx_t> &filter,
+                                     Vector &group_hashes) const {
+	SinkInternal(context, chunk, input, payload_input, filter, &group_hashes);
+}
+
+void RadixPartitionedHashTable::SinkInternal(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
+                                             DataChunk &payload_input, const unsafe_vector<idx_t> &filter,
+                                             optional_ptr<Vector> group_hashes) const {
 	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<RadixHTLocalSinkState>();
 	if (!lstate.ht) {
@@ -433,7 +445,11 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	PopulateGroupChunk(group_chunk, chunk);
 
 	auto &ht = *lstate.ht;
-	ht.AddChunk(group_chunk, payload_input, filter);
+	if (group_hashes) {
+		ht.AddChunk(group_chunk, *group_hashes, payload_input, filter);
+	} else {
+		ht.AddChunk(group_chunk, payload_input, filter);
+	}
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
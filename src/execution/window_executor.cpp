@@ -872,6 +872,19 @@ bool WindowAggregateExecutor::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+bool WindowAggregateExecutor::IsPrefixSumAggregate() {
+	if (!wexpr.aggregate) {
+		return false;
+	}
+
+	//	As with custom aggregates, COMBINE mode forces the segment tree
+	if (mode >= WindowAggregationMode::COMBINE) {
+		return false;
+	}
+
+	return WindowPrefixSumAggregator::CanAggregate(AggregateObject(wexpr), wexpr.return_type);
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result,
                               WindowExecutorState &lstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -886,27 +899,34 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, ClientContext &context,
                                                  const idx_t count, const ValidityMask &partition_mask,
                                                  const ValidityMask &order_mask, WindowAggregationMode mode)
-    : WindowExecutor(wexpr, context, count, partition_mask, order_mask), mode(mode), filter_executor(context) {
+    : WindowExecutor(wexpr, context, count, partition_mask, order_mask), mode(mode), filter_executor(context),
+      frame_independent(false), shared(false) {
 
 	// Force naive for SEPARATE mode or for (currently!) unsupported functionality
 	const auto force_naive =
 	    !ClientConfig::GetConfig(context).enable_optimizer || mode == WindowAggregationMode::SEPARATE;
 	AggregateObject aggr(wexpr);
 	if (force_naive || (wexpr.distinct && wexpr.exclude_clause != WindowExcludeMode::NO_OTHER)) {
-		aggregator = make_uniq<WindowNaiveAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+		aggregator = make_shared<WindowNaiveAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
 	} else if (IsDistinctAggregate()) {
 		// build a merge sort tree
 		// see https://dl.acm.org/doi/pdf/10.1145/3514221.3526184
-		aggregator = make_uniq<WindowDistinctAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count, context);
+		aggregator =
+		    make_shared<WindowDistinctAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count, context);
 	} else if (IsConstantAggregate()) {
 		aggregator =
-		    make_uniq<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause, count);
+		    make_shared<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause, count);
 	} else if (IsCustomAggregate()) {
-		aggregator = make_uniq<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+		aggregator = make_shared<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+	} else if (IsPrefixSumAggregate()) {
+		// subtract the prefix sum before the frame from the one at its end
+		aggregator = make_shared<WindowPrefixSumAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+		frame_independent = true;
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
-		aggregator = make_uniq<WindowSegmentTree>(aggr, wexpr.return_type, mode, wexpr.exclude_clause, count);
+		aggregator = make_shared<WindowSegmentTree>(aggr, wexpr.return_type, mode, wexpr.exclude_clause, count);
+		frame_independent = true;
 	}
 
 	// evaluate the FILTER clause and stuff it into a large mask for compactness and reuse
@@ -916,7 +936,40 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 	}
 }
 
+bool WindowAggregateExecutor::CanShareAggregator(const WindowAggregateExecutor &other) const {
+	//	Aggregators that are chosen or built according to the frame cannot be shared
+	if (!frame_independent || !other.frame_independent || other.shared) {
+		return false;
+	}
+	auto &other_expr = other.wexpr;
+	if (wexpr.distinct != other_expr.distinct || wexpr.exclude_clause != other_expr.exclude_clause) {
+		return false;
+	}
+	if (*wexpr.aggregate != *other_expr.aggregate) {
+		return false;
+	}
+	if (wexpr.bind_info.get() != other_expr.bind_info.get()) {
+		if (!wexpr.bind_info || !other_expr.bind_info || !wexpr.bind_info->Equals(*other_expr.bind_info)) {
+			return false;
+		}
+	}
+	return Expression::ListEquals(wexpr.children, other_expr.children) &&
+	       Expression::Equals(wexpr.filter_expr, other_expr.filter_expr);
+}
+
+void WindowAggregateExecutor::ShareAggregator(const WindowAggregateExecutor &other) {
+	D_ASSERT(CanShareAggregator(other));
+	aggregator = other.aggregator;
+	shared = true;
+}
+
 void WindowAggregateExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) {
+	if (shared) {
+		//	The aggregator is built by the executor we share it with
+		WindowExecutor::Sink(input_chunk, input_idx, total_count);
+		return;
+	}
+
 	// TODO we could evaluate those expressions in parallel
 	idx_t filtered = 0;
 	SelectionVector *filtering = nullptr;
@@ -942,6 +995,9 @@ void WindowAggregateExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx
 
 void WindowAggregateExecutor::Finalize() {
 	D_ASSERT(aggregator);
+	if (shared) {
+		return;
+	}
 
 	//	Estimate the frame statistics
 	//	Default to the entire partition if we don't know anything
@@ -1015,6 +1071,16 @@ void WindowAggregateExecutor::Finalize() {
 	aggregator->Finalize(stats);
 }
 
+idx_t WindowAggregateExecutor::GetFinalizeTasks() const {
+	D_ASSERT(aggregator);
+	return shared ? 0 : aggregator->GetFinalizeTasks();
+}
+
+void WindowAggregateExecutor::FinalizeTask(idx_t task_idx) {
+	D_ASSERT(aggregator && !shared);
+	aggregator->FinalizeTask(task_idx);
+}
+
 class WindowAggregateState : public WindowExecutorBoundsState {
 public:
 	WindowAggregateState(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
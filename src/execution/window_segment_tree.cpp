@@ -2,6 +2,7 @@
 
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/types/hugeint.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
@@ -391,6 +392,189 @@ void WindowCustomAggregator::Evaluate(WindowAggregatorState &lstate, const DataC
 	});
 }
 
+//===--------------------------------------------------------------------===//
+// WindowPrefixSumAggregator
+//===--------------------------------------------------------------------===//
+static WindowPrefixSumAggregator::PrefixSumFunction GetPrefixSumFunction(const string &name) {
+	if (name == "count" || name == "count_star") {
+		return WindowPrefixSumAggregator::PrefixSumFunction::COUNT;
+	}
+	if (name == "avg") {
+		return WindowPrefixSumAggregator::PrefixSumFunction::AVG;
+	}
+	D_ASSERT(name == "sum");
+	return WindowPrefixSumAggregator::PrefixSumFunction::SUM;
+}
+
+bool WindowPrefixSumAggregator::CanAggregate(const AggregateObject &aggr, const LogicalType &result_type) {
+	//	The decimal scaling of AVG is hidden in its bind data
+	if (aggr.IsDistinct() || aggr.GetFunctionData()) {
+		return false;
+	}
+	auto &name = aggr.function.name;
+	if (name == "count_star") {
+		return true;
+	}
+	if (aggr.function.arguments.size() != 1) {
+		return false;
+	}
+	if (name == "count") {
+		return true;
+	}
+	//	HUGEINT inputs can overflow (and have to throw)
+	switch (aggr.function.arguments[0].InternalType()) {
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+		break;
+	default:
+		return false;
+	}
+	if (name == "sum") {
+		return result_type.InternalType() == PhysicalType::INT128;
+	}
+	if (name == "avg") {
+		return result_type.id() == LogicalTypeId::DOUBLE;
+	}
+	return false;
+}
+
+WindowPrefixSumAggregator::WindowPrefixSumAggregator(AggregateObject aggr, const LogicalType &result_type,
+                                                     const WindowExcludeMode exclude_mode_p, idx_t count)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count),
+      function(GetPrefixSumFunction(this->aggr.function.name)) {
+	counts.reserve(count + 1);
+	counts.emplace_back(0);
+	if (function != PrefixSumFunction::COUNT) {
+		sums.reserve(count + 1);
+		sums.emplace_back(0);
+	}
+}
+
+WindowPrefixSumAggregator::~WindowPrefixSumAggregator() {
+}
+
+template <class T>
+static void PrefixSumValues(const UnifiedVectorFormat &vdata, const ValidityMask &included, idx_t count,
+                            vector<uint64_t> &counts, vector<hugeint_t> &sums) {
+	auto values = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; ++i) {
+		const auto idx = vdata.sel->get_index(i);
+		if (included.RowIsValid(i) && vdata.validity.RowIsValid(idx)) {
+			counts.emplace_back(counts.back() + 1);
+			sums.emplace_back(sums.back() + hugeint_t(values[idx]));
+		} else {
+			counts.emplace_back(counts.back());
+			sums.emplace_back(sums.back());
+		}
+	}
+}
+
+void WindowPrefixSumAggregator::Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) {
+	//	The input is not materialised: only the prefix sums are needed
+	const auto count = payload_chunk.size();
+	ValidityMask included(count);
+	if (filter_sel) {
+		included.SetAllInvalid(count);
+		for (idx_t f = 0; f < filtered; ++f) {
+			included.SetValid(filter_sel->get_index(f));
+		}
+	}
+
+	if (!payload_chunk.ColumnCount()) {
+		//	COUNT(*)
+		for (idx_t i = 0; i < count; ++i) {
+			counts.emplace_back(counts.back() + included.RowIsValid(i));
+		}
+		return;
+	}
+
+	UnifiedVectorFormat vdata;
+	payload_chunk.data[0].ToUnifiedFormat(count, vdata);
+	if (function == PrefixSumFunction::COUNT) {
+		for (idx_t i = 0; i < count; ++i) {
+			const auto valid = included.RowIsValid(i) && vdata.validity.RowIsValid(vdata.sel->get_index(i));
+			counts.emplace_back(counts.back() + valid);
+		}
+		return;
+	}
+
+	switch (payload_chunk.data[0].GetType().InternalType()) {
+	case PhysicalType::INT16:
+		PrefixSumValues<int16_t>(vdata, included, count, counts, sums);
+		break;
+	case PhysicalType::INT32:
+		PrefixSumValues<int32_t>(vdata, included, count, counts, sums);
+		break;
+	case PhysicalType::INT64:
+		PrefixSumValues<int64_t>(vdata, included, count, counts, sums);
+		break;
+	default:
+		throw InternalException("Unsupported type for prefix sum window aggregate");
+	}
+}
+
+class WindowPrefixSumState : public WindowAggregatorState {
+public:
+	explicit WindowPrefixSumState(const WindowExcludeMode exclude_mode) {
+		InitSubFrames(frames, exclude_mode);
+	}
+
+	//! The frame boundaries, with the excluded rows cut out
+	SubFrames frames;
+};
+
+unique_ptr<WindowAggregatorState> WindowPrefixSumAggregator::GetLocalState() const {
+	return make_uniq<WindowPrefixSumState>(exclude_mode);
+}
+
+void WindowPrefixSumAggregator::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result,
+                                         idx_t count, idx_t row_idx) const {
+	auto &frames = lstate.Cast<WindowPrefixSumState>().frames;
+
+	EvaluateSubFrames(bounds, exclude_mode, count, row_idx, frames, [&](idx_t rid) {
+		//	Add the values that entered the frame and subtract the ones that left it
+		uint64_t frame_count = 0;
+		hugeint_t frame_sum = 0;
+		for (const auto &frame : frames) {
+			if (frame.start >= frame.end) {
+				continue;
+			}
+			frame_count += counts[frame.end] - counts[frame.start];
+			if (function != PrefixSumFunction::COUNT) {
+				frame_sum += sums[frame.end] - sums[frame.start];
+			}
+		}
+
+		switch (function) {
+		case PrefixSumFunction::COUNT:
+			FlatVector::GetData<int64_t>(result)[rid] = int64_t(frame_count);
+			return;
+		case PrefixSumFunction::SUM:
+			if (!frame_count) {
+				FlatVector::SetNull(result, rid, true);
+				return;
+			}
+			FlatVector::GetData<hugeint_t>(result)[rid] = frame_sum;
+			return;
+		case PrefixSumFunction::AVG:
+			if (!frame_count) {
+				FlatVector::SetNull(result, rid, true);
+				return;
+			}
+			//	Divide the same way the aggregate finalises its state
+			if (aggr.function.arguments[0].InternalType() == PhysicalType::INT16) {
+				FlatVector::GetData<double>(result)[rid] =
+				    double(Hugeint::Cast<int64_t>(frame_sum)) / double(frame_count);
+			} else {
+				FlatVector::GetData<double>(result)[rid] =
+				    Hugeint::Cast<long double>(frame_sum) / (long double)(frame_count);
+			}
+			return;
+		}
+	});
+}
+
 //===--------------------------------------------------------------------===//
 // WindowNaiveAggregator
 //===--------------------------------------------------------------------===//
@@ -601,17 +785,16 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 //===--------------------------------------------------------------------===//
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
                                      const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p) {
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p),
+      finished_tasks(0) {
 }
 
 void WindowSegmentTree::Finalize(const FrameStats &stats) {
 	WindowAggregator::Finalize(stats);
 
 	gstate = GetLocalState();
-	if (inputs.ColumnCount() > 0) {
-		if (aggr.function.combine && UseCombineAPI()) {
-			ConstructTree();
-		}
+	if (aggr.function.combine && UseCombineAPI()) {
+		InitializeTree();
 	}
 }
 
@@ -730,8 +913,8 @@ WindowSegmentTreePart::WindowSegmentTreePart(ArenaAllocator &allocator, const Ag
       statep(LogicalType::POINTER), statel(LogicalType::POINTER), statef(LogicalType::POINTER), flush_count(0) {
 	if (inputs.ColumnCount() > 0) {
 		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
-		filter_sel.Initialize();
 	}
+	filter_sel.Initialize();
 
 	//	Build the finalise vector that just points to the result states
 	data_ptr_t state_ptr = state.data();
@@ -764,7 +947,7 @@ void WindowSegmentTreePart::FlushStates(bool combining) {
 	} else {
 		leaves.Reference(inputs);
 		leaves.Slice(filter_sel, flush_count);
-		aggr.function.update(&leaves.data[0], aggr_input_data, leaves.ColumnCount(), statep, flush_count);
+		aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), statep, flush_count);
 	}
 
 	flush_count = 0;
@@ -806,7 +989,7 @@ void WindowSegmentTreePart::ExtractFrame(idx_t begin, idx_t end, data_ptr_t stat
 void WindowSegmentTreePart::WindowSegmentValue(const WindowSegmentTree &tree, idx_t l_idx, idx_t begin, idx_t end,
                                                data_ptr_t state_ptr) {
 	D_ASSERT(begin <= end);
-	if (begin == end || inputs.ColumnCount() == 0) {
+	if (begin == end) {
 		return;
 	}
 
@@ -840,47 +1023,66 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 	}
 }
 
-void WindowSegmentTree::ConstructTree() {
-	D_ASSERT(inputs.ColumnCount() > 0);
-
-	//	Use a temporary scan state to build the tree
-	auto &gtstate = gstate->Cast<WindowSegmentTreeState>().part;
-
+void WindowSegmentTree::InitializeTree() {
 	// compute space required to store internal nodes of segment tree
-	internal_nodes = 0;
-	idx_t level_nodes = inputs.size();
-	do {
+	//	Zero-argument aggregates (e.g., COUNT(*)) have no inputs, so use the partition size
+	levels_flat_start.push_back(0);
+	idx_t level_nodes = partition_count;
+	while (level_nodes > 1) {
 		level_nodes = (level_nodes + (TREE_FANOUT - 1)) / TREE_FANOUT;
-		internal_nodes += level_nodes;
-	} while (level_nodes > 1);
+		levels_flat_start.push_back(levels_flat_start.back() + level_nodes);
+	}
+	internal_nodes = MaxValue<idx_t>(levels_flat_start.back(), 1);
 	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
-	levels_flat_start.push_back(0);
 
-	idx_t levels_flat_offset = 0;
-	idx_t level_current = 0;
-	// level 0 is data itself
-	idx_t level_size;
-	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? inputs.size() : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
-			// compute the aggregate for this entry in the segment tree
-			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_offset * state_size);
-			aggr.function.initialize(state_ptr);
-			gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
-			gtstate.FlushStates(level_current > 0);
-
-			levels_flat_offset++;
-		}
+	// Corner case: single element in the window
+	if (levels_flat_start.size() == 1) {
+		aggr.function.initialize(levels_flat_native.get());
+	}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
+	task_states.resize(GetFinalizeTasks());
+}
+
+idx_t WindowSegmentTree::GetFinalizeTasks() const {
+	if (levels_flat_start.size() < 2) {
+		return 0;
 	}
+	// the first level is by far the largest, so only that one is split into tasks
+	const auto level_nodes = levels_flat_start[1];
+	return (level_nodes + TASK_NODES - 1) / TASK_NODES;
+}
 
-	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
-		aggr.function.initialize(levels_flat_native.get());
+void WindowSegmentTree::FinalizeTask(idx_t task_idx) {
+	//	Each task has its own scan state
+	auto &task_state = task_states[task_idx];
+	task_state = GetLocalState();
+	const auto begin = task_idx * TASK_NODES;
+	const auto end = MinValue(begin + TASK_NODES, levels_flat_start[1]);
+	ConstructLevel(*task_state, 0, begin, end);
+
+	//	The last task to finish builds the upper levels on top of the first one
+	if (++finished_tasks < task_states.size()) {
+		return;
+	}
+	for (idx_t level = 1; level + 1 < levels_flat_start.size(); ++level) {
+		const auto level_nodes = levels_flat_start[level + 1] - levels_flat_start[level];
+		ConstructLevel(*gstate, level, 0, level_nodes);
+	}
+}
+
+void WindowSegmentTree::ConstructLevel(WindowAggregatorState &lstate, idx_t level, idx_t begin, idx_t end) {
+	auto &gtstate = lstate.Cast<WindowSegmentTreeState>().part;
+
+	// level 0 is data itself
+	const auto level_size = level ? levels_flat_start[level] - levels_flat_start[level - 1] : partition_count;
+	for (idx_t node = begin; node < end; ++node) {
+		// compute the aggregate for this entry in the segment tree
+		data_ptr_t state_ptr = levels_flat_native.get() + ((levels_flat_start[level] + node) * state_size);
+		aggr.function.initialize(state_ptr);
+		const auto pos = node * TREE_FANOUT;
+		gtstate.WindowSegmentValue(*this, level, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
 	}
+	gtstate.FlushStates(level > 0);
 }
 
 void WindowSegmentTree::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
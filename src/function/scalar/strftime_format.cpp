@@ -647,15 +647,26 @@ void StrfTimeFormat::ConvertDateVector(Vector &input, Vector &result, idx_t coun
 void StrfTimeFormat::ConvertTimestampVector(Vector &input, Vector &result, idx_t count) {
 	D_ASSERT(input.GetType().id() == LogicalTypeId::TIMESTAMP || input.GetType().id() == LogicalTypeId::TIMESTAMP_TZ);
 	D_ASSERT(result.GetType().id() == LogicalTypeId::VARCHAR);
+	// timestamps in a vector are often on the same day: only convert the date once for each run of equal days
+	int32_t data[8]; // year, month, day, hour, min, sec, µs, offset
+	data[7] = 0;
+	date_t last_date;
+	bool has_last_date = false;
 	UnaryExecutor::ExecuteWithNulls<timestamp_t, string_t>(
 	    input, result, count, [&](timestamp_t input, ValidityMask &mask, idx_t idx) {
 		    if (Timestamp::IsFinite(input)) {
 			    date_t date;
 			    dtime_t time;
 			    Timestamp::Convert(input, date, time);
+			    if (!has_last_date || date != last_date) {
+				    Date::Convert(date, data[0], data[1], data[2]);
+				    last_date = date;
+				    has_last_date = true;
+			    }
+			    Time::Convert(time, data[3], data[4], data[5], data[6]);
 			    idx_t len = GetLength(date, time, 0, nullptr);
 			    string_t target = StringVector::EmptyString(result, len);
-			    FormatString(date, time, target.GetDataWriteable());
+			    FormatString(date, data, nullptr, target.GetDataWriteable());
 			    target.Finalize();
 			    return target;
 		    } else {
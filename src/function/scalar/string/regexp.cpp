@@ -12,6 +12,7 @@
 
 namespace duckdb {
 
+using regexp_util::ContainsLiteral;
 using regexp_util::CreateStringPiece;
 using regexp_util::Extract;
 using regexp_util::ParseRegexOptions;
@@ -59,21 +60,23 @@ RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, s
 		}
 
 		range_success = pattern->PossibleMatchRange(&range_min, &range_max, 1000);
+		anchored_start = pattern->Anchored() != RE2::UNANCHORED;
 	} else {
 		range_success = false;
+		anchored_start = false;
 	}
 }
 
 RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, string constant_string_p,
                                              bool constant_pattern, string range_min_p, string range_max_p,
-                                             bool range_success)
+                                             bool range_success, bool anchored_start)
     : RegexpBaseBindData(options, std::move(constant_string_p), constant_pattern), range_min(std::move(range_min_p)),
-      range_max(std::move(range_max_p)), range_success(range_success) {
+      range_max(std::move(range_max_p)), range_success(range_success), anchored_start(anchored_start) {
 }
 
 unique_ptr<FunctionData> RegexpMatchesBindData::Copy() const {
 	return make_uniq<RegexpMatchesBindData>(options, constant_string, constant_pattern, range_min, range_max,
-	                                        range_success);
+	                                        range_success, anchored_start);
 }
 
 unique_ptr<FunctionData> RegexpMatchesBind(ClientContext &context, ScalarFunction &bound_function,
@@ -114,6 +117,16 @@ static void RegexpMatchesFunction(DataChunk &args, ExpressionState &state, Vecto
 
 	if (info.constant_pattern) {
 		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
+		if (lstate.has_required_literal) {
+			// only run the regex on rows that contain the literal every match requires
+			UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
+				if (!ContainsLiteral(input, lstate.required_literal)) {
+					return false;
+				}
+				return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
+			});
+			return;
+		}
 		UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
 			return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
 		});
@@ -227,6 +240,10 @@ static void RegexExtractFunction(DataChunk &args, ExpressionState &state, Vector
 	if (info.constant_pattern) {
 		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
 		UnaryExecutor::Execute<string_t, string_t>(strings, result, args.size(), [&](string_t input) {
+			if (lstate.has_required_literal && !ContainsLiteral(input, lstate.required_literal)) {
+				// no match possible: extract returns an empty string
+				return string_t(nullptr, 0);
+			}
 			return Extract(input, result, lstate.constant_pattern, info.rewrite);
 		});
 	} else {
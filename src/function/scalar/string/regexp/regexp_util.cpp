@@ -1,5 +1,9 @@
 #include "duckdb/function/scalar/regexp.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/scalar/string_functions.hpp"
+#include "utf8proc_wrapper.hpp"
+
+#include "re2/regexp.h"
 
 namespace duckdb {
 
@@ -78,6 +82,87 @@ void ParseRegexOptions(ClientContext &context, Expression &expr, RE2::Options &t
 	ParseRegexOptions(StringValue::Get(options_str), target, global_replace);
 }
 
+static bool TryGetLiteral(duckdb_re2::Regexp &regexp, string &result) {
+	if (regexp.parse_flags() & (duckdb_re2::Regexp::FoldCase | duckdb_re2::Regexp::Latin1)) {
+		// case-insensitive literals can match several byte sequences
+		return false;
+	}
+	duckdb_re2::Rune rune;
+	duckdb_re2::Rune *runes = &rune;
+	int nrunes = 1;
+	if (regexp.op() == duckdb_re2::kRegexpLiteralString) {
+		runes = regexp.runes();
+		nrunes = regexp.nrunes();
+	} else {
+		rune = regexp.rune();
+	}
+	string literal;
+	for (int i = 0; i < nrunes; i++) {
+		int sz = 0;
+		char utf8_str[4];
+		if (!Utf8Proc::CodepointToUtf8(runes[i], sz, utf8_str)) {
+			return false;
+		}
+		literal.append(utf8_str, sz);
+	}
+	result = std::move(literal);
+	return true;
+}
+
+static bool TryExtractLiteralFromRegexp(duckdb_re2::Regexp &regexp, string &result) {
+	switch (regexp.op()) {
+	case duckdb_re2::kRegexpLiteral:
+	case duckdb_re2::kRegexpLiteralString:
+		return TryGetLiteral(regexp, result);
+	case duckdb_re2::kRegexpCapture:
+	case duckdb_re2::kRegexpPlus:
+		// the sub-expression has to match at least once
+		return TryExtractLiteralFromRegexp(*regexp.sub()[0], result);
+	case duckdb_re2::kRegexpRepeat:
+		if (regexp.min() < 1) {
+			return false;
+		}
+		return TryExtractLiteralFromRegexp(*regexp.sub()[0], result);
+	case duckdb_re2::kRegexpConcat: {
+		// every child of a concatenation has to match - pick the longest literal among them
+		bool found = false;
+		for (int i = 0; i < regexp.nsub(); i++) {
+			string literal;
+			if (TryExtractLiteralFromRegexp(*regexp.sub()[i], literal) && (!found || literal.size() > result.size())) {
+				result = std::move(literal);
+				found = true;
+			}
+		}
+		return found;
+	}
+	default:
+		return false;
+	}
+}
+
+bool TryExtractRequiredLiteral(const duckdb_re2::RE2 &pattern, string &result) {
+	if (!pattern.ok() || pattern.options().encoding() != duckdb_re2::RE2::Options::EncodingUTF8) {
+		return false;
+	}
+	auto regexp = pattern.Regexp();
+	if (!regexp) {
+		return false;
+	}
+	string literal;
+	if (!TryExtractLiteralFromRegexp(*regexp, literal) || literal.empty()) {
+		return false;
+	}
+	result = std::move(literal);
+	return true;
+}
+
+bool ContainsLiteral(const string_t &input, const string &literal) {
+	D_ASSERT(!literal.empty());
+	auto haystack = const_uchar_ptr_cast(input.GetData());
+	auto needle = const_uchar_ptr_cast(literal.c_str());
+	return ContainsFun::Find(haystack, input.GetSize(), needle, literal.size()) != DConstants::INVALID_INDEX;
+}
+
 } // namespace regexp_util
 
 } // namespace duckdb
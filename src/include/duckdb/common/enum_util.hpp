@@ -40,6 +40,8 @@ enum class AggregateHandling : uint8_t;
 
 enum class AggregateOrderDependent : uint8_t;
 
+enum class AggregateStateGrowth : uint8_t;
+
 enum class AggregateType : uint8_t;
 
 enum class AlterForeignKeyType : uint8_t;
@@ -323,6 +325,9 @@ const char* EnumUtil::ToChars<AggregateHandling>(AggregateHandling value);
 template<>
 const char* EnumUtil::ToChars<AggregateOrderDependent>(AggregateOrderDependent value);
 
+template<>
+const char* EnumUtil::ToChars<AggregateStateGrowth>(AggregateStateGrowth value);
+
 template<>
 const char* EnumUtil::ToChars<AggregateType>(AggregateType value);
 
@@ -741,6 +746,9 @@ AggregateHandling EnumUtil::FromString<AggregateHandling>(const char *value);
 template<>
 AggregateOrderDependent EnumUtil::FromString<AggregateOrderDependent>(const char *value);
 
+template<>
+AggregateStateGrowth EnumUtil::FromString<AggregateStateGrowth>(const char *value);
+
 template<>
 AggregateType EnumUtil::FromString<AggregateType>(const char *value);
 
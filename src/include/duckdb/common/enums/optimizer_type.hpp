@@ -32,6 +32,7 @@ enum class OptimizerType : uint32_t {
 	COMPRESSED_MATERIALIZATION,
 	DUPLICATE_GROUPS,
 	REORDER_FILTER,
+	EAGER_AGGREGATE,
 	EXTENSION
 };
 
@@ -22,6 +22,13 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Size of a string in the sort key (including the NULL byte) if we do not know how long the strings are
+	static constexpr idx_t STRING_KEY_SIZE = 12;
+	//! Strings that fit in this many bytes (including the NULL byte) are stored in the sort key completely,
+	//! so that they never need to be compared using the blob data when there is a tie
+	static constexpr idx_t MAX_FULL_STRING_KEY_SIZE = 64;
+	//! Size of the prefix in the sort key of strings that are known to be longer than that
+	static constexpr idx_t LONG_STRING_KEY_SIZE = 32;
 };
 
 struct SortLayout {
@@ -91,6 +98,11 @@ public:
 	//! Whether we are doing an external sort
 	bool external;
 
+	//! Maximum number of sorted blocks that are merged at once during an external merge round
+	static constexpr idx_t MAX_MERGE_FAN_IN = 16;
+	//! Number of sorted blocks merged at once in the current round (2 for the parallel Merge Path merge)
+	idx_t merge_fan_in;
+
 	//! Progress in merge path stage
 	idx_t pair_idx;
 	idx_t num_pairs;
@@ -170,6 +182,10 @@ private:
 	unique_ptr<SortedBlock> right_input;
 	SortedBlock *result;
 
+	//! The readers of a k-way merge (one per input block), and the loser tree over them
+	vector<unique_ptr<SBScanState>> readers;
+	vector<idx_t> loser_tree;
+
 private:
 	//! Computes the left and right block that will be merged next (Merge Path partition)
 	void GetNextPartition();
@@ -181,6 +197,18 @@ private:
 	//! Finds the next partition and merges it
 	void MergePartition();
 
+	//! Finds groups of more than two blocks and merges each of them in a single pass
+	void PerformKWayMerge();
+	//! Merges a group of sorted blocks using a loser tree, appending the result blocks to 'results'
+	void MergeGroup(vector<unique_ptr<SortedBlock>> &group, vector<unique_ptr<SortedBlock>> &results);
+	//! Moves a k-way merge reader past exhausted blocks, and pins the block it is reading (if any)
+	void PinReader(SBScanState &reader);
+	//! Whether the current row of reader 'l_idx' sorts before that of reader 'r_idx' (exhausted readers sort last)
+	bool ReaderIsSmaller(const idx_t l_idx, const idx_t r_idx);
+	//! Appends the current row of a reader (and its heap entry, if needed) to the result
+	void AppendRow(SortedData &result_data, BufferHandle &result_data_handle, BufferHandle &result_heap_handle,
+	               SortedData &source_data, SBScanState &reader);
+
 	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
 	void ComputeMerge(const idx_t &count, bool left_smaller[]);
 
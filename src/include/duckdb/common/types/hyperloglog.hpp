@@ -38,6 +38,8 @@ public:
 	//! Merge this HyperLogLog counter with another counter to create a new one
 	unique_ptr<HyperLogLog> Merge(HyperLogLog &other);
 	HyperLogLog *MergePointer(HyperLogLog &other);
+	//! Merge another HyperLogLog counter into this counter
+	void MergeInPlace(HyperLogLog &other);
 	//! Merge a set of HyperLogLogs to create one big one
 	static unique_ptr<HyperLogLog> Merge(HyperLogLog logs[], idx_t count);
 	//! Get the size (in bytes) of a HLL
@@ -60,6 +62,10 @@ public:
 	                      HyperLogLog **logs[], const SelectionVector *log_sel);
 	//! Add the indices and counts to THIS log
 	void AddToLog(UnifiedVectorFormat &vdata, idx_t count, uint64_t indices[], uint8_t counts[]);
+	//! Add a single register index and count (as computed by ProcessEntries) to THIS log
+	void AddToLog(uint64_t index, uint8_t count);
+	//! Return the count of a HyperLogLog counter of which only the registers with the given counts are set
+	static idx_t Count(const uint8_t counts[], idx_t count);
 
 private:
 	explicit HyperLogLog(duckdb_hll::robj *hll);
@@ -10,28 +10,44 @@
 
 #include "duckdb/planner/expression/list.hpp"
 
-#include <random>
 namespace duckdb {
 
+//! Reorders the predicates of a conjunction (or the filters of a table scan) based on their observed cost and
+//! selectivity: predicates that are cheap and filter out many rows are evaluated first
 class AdaptiveFilter {
 public:
 	explicit AdaptiveFilter(const Expression &expr);
 	explicit AdaptiveFilter(TableFilterSet *table_filters);
-	void AdaptRuntimeStatistics(double duration);
+
+	//! Records that evaluating the predicate at position 'idx' of the permutation on 'input_count' rows took
+	//! 'duration' seconds, and that 'output_count' of these rows were passed on to the next predicate
+	void AdaptRuntimeStatistics(idx_t idx, double duration, idx_t input_count, idx_t output_count);
+	//! Called after every chunk: periodically reorders the predicates by their observed rank
+	void FinishChunk();
+
+	//! The order in which the predicates are evaluated
 	vector<idx_t> permutation;
 
 private:
-	//! used for adaptive expression reordering
-	idx_t iteration_count;
-	idx_t swap_idx;
-	idx_t right_random_border;
-	idx_t observe_interval;
-	idx_t execute_interval;
-	double runtime_sum;
-	double prev_mean;
-	bool observe;
-	bool warmup;
-	vector<idx_t> swap_likeliness;
-	std::default_random_engine generator;
+	struct PredicateStatistics {
+		double duration = 0;
+		double input_count = 0;
+		double output_count = 0;
+	};
+	//! Rank of a predicate: the cost per row divided by the fraction of rows that it removes from further evaluation
+	static double GetRank(const PredicateStatistics &stats);
+
+private:
+	//! Number of chunks between two reorderings of the predicates
+	static constexpr idx_t ADAPT_INTERVAL = 16;
+
+	//! The predicates, in their initial order
+	vector<idx_t> predicates;
+	//! The statistics of every predicate
+	vector<PredicateStatistics> statistics;
+	//! The permutation, as indexes into predicates
+	vector<idx_t> order;
+	//! Number of chunks since the last reordering
+	idx_t chunk_count;
 };
 } // namespace duckdb
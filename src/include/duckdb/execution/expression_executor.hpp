@@ -108,6 +108,13 @@ protected:
 	void Execute(const Expression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
 	             Vector &result);
 
+	//! Execute the expression based on its class
+	void ExecuteInternal(const Expression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
+	                     Vector &result);
+	//! Execute an expression whose result is shared with other occurrences of the same expression
+	void ExecuteShared(const Expression &expr, ExpressionState &state, const SelectionVector *sel, idx_t count,
+	                   Vector &result);
+
 	void Execute(const BoundBetweenExpression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
 	             Vector &result);
 	void Execute(const BoundCaseExpression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
@@ -148,6 +155,9 @@ protected:
 	void Verify(const Expression &expr, Vector &result, idx_t count);
 
 	void FillSwitch(Vector &vector, Vector &result, const SelectionVector &sel, sel_t count);
+	//! Execute a CASE expression using the lookup table of its state
+	void ExecuteCaseLookup(const BoundCaseExpression &expr, ExpressionState &state, const SelectionVector *sel,
+	                       idx_t count, Vector &result);
 
 private:
 	//! Client context
@@ -19,6 +19,21 @@ class ExpressionExecutor;
 struct ExpressionExecutorState;
 struct FunctionLocalState;
 
+//! The result of a subexpression that occurs more than once in an expression, e.g., lower(url) in several CASE
+//! branches. The rows that were computed for the current chunk are cached, and reused by every occurrence
+struct SharedExpressionResult {
+	SharedExpressionResult(Allocator &allocator, const LogicalType &type);
+
+	//! The evaluation of the root expression the cached rows belong to
+	idx_t epoch;
+	//! The cached rows, at the position of the row in the input chunk
+	DataChunk cache;
+	//! The rows of the cache that were computed
+	ValidityMask computed;
+	//! The rows that still need to be computed
+	SelectionVector missing_sel;
+};
+
 struct ExpressionState {
 	ExpressionState(const Expression &expr, ExpressionExecutorState &root);
 	virtual ~ExpressionState() {
@@ -30,6 +45,8 @@ struct ExpressionState {
 	vector<LogicalType> types;
 	DataChunk intermediate_chunk;
 	CycleCounter profiler;
+	//! Set if the result of this expression is shared with other occurrences of the same expression
+	optional_ptr<SharedExpressionResult> shared_result;
 
 public:
 	void AddChild(Expression *expr);
@@ -71,6 +88,10 @@ struct ExpressionExecutorState {
 	unique_ptr<ExpressionState> root_state;
 	ExpressionExecutor *executor = nullptr;
 	CycleCounter profiler;
+	//! Results of subexpressions that occur more than once in the expression
+	vector<unique_ptr<SharedExpressionResult>> shared_results;
+	//! Incremented every time the root expression is evaluated, which invalidates the shared results
+	idx_t epoch = 0;
 
 	void Verify();
 };
@@ -60,6 +60,39 @@ class JoinHashTable {
 public:
 	using ValidityBytes = TemplatedValidityMask<uint8_t>;
 
+	//! A key hash that occurs so often on the build side that its rows are stored densely,
+	//! instead of in a (very long) chain of the pointer table
+	struct HeavyHitter {
+		hash_t hash;
+		vector<data_ptr_t> rows;
+	};
+
+	//! The probe rows of a chunk that have a heavy hitter key. Each of them is broadcast
+	//! across the rows of its heavy hitter, a vector at a time.
+	struct HeavyHitterProbe {
+		explicit HeavyHitterProbe(const vector<LogicalType> &condition_types);
+
+		//! The heavy probe rows, and the index of their heavy hitter
+		SelectionVector sel;
+		idx_t heavy_hitter[STANDARD_VECTOR_SIZE];
+		idx_t count;
+		//! The current heavy probe row, and the offset in the rows of its heavy hitter
+		idx_t position;
+		idx_t offset;
+		//! The remaining probe rows, which are probed through the pointer table
+		SelectionVector light_sel;
+
+		//! The current probe key, repeated for every matched row
+		SelectionVector broadcast_sel;
+		DataChunk keys;
+		TupleDataChunkState key_state;
+		//! The heavy hitter rows that are matched, and the ones that matched
+		Vector rows;
+		SelectionVector match_sel;
+		//! The matched heavy hitter rows of the result, which can belong to several probe rows
+		Vector result_rows;
+	};
+
 	//! Scan structure that can be used to resume scans, as a single probe can
 	//! return 1024*N values (where N is the size of the HT). This is
 	//! returned by the JoinHashTable::Scan function and can be used to resume a
@@ -73,6 +106,8 @@ public:
 		unsafe_unique_array<bool> found_match;
 		JoinHashTable &ht;
 		bool finished;
+		//! The probe rows with a heavy hitter key (if any), which are not probed through the pointer table
+		unique_ptr<HeavyHitterProbe> heavy;
 
 		explicit ScanStructure(JoinHashTable &ht, TupleDataChunkState &key_state);
 		//! Get the next batch of data from the scan structure
@@ -104,6 +139,14 @@ public:
 
 		idx_t ScanInnerJoin(DataChunk &keys, SelectionVector &result_vector);
 
+		//! Next operator for the probe rows with a heavy hitter key, after the pointer chains are exhausted
+		void NextHeavyHitterJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
+		//! Match the current heavy probe row against the next (at most max_count) rows of its heavy hitter,
+		//! returning the number of matches (in heavy->match_sel)
+		idx_t ScanHeavyHitter(DataChunk &keys, idx_t max_count);
+		//! Find the first row of its heavy hitter that matches the given heavy probe row (or nullptr)
+		data_ptr_t FindHeavyHitterMatch(DataChunk &keys, idx_t position);
+
 	public:
 		void InitializeSelectionVector(const SelectionVector *&current_sel);
 		void AdvancePointers();
@@ -127,6 +170,8 @@ public:
 	void Unpartition();
 	//! Initialize the pointer table for the probe
 	void InitializePointerTable();
+	//! Sample the build side for heavy hitters, which Finalize keeps out of the pointer table
+	void DetectHeavyHitters();
 	//! Finalize the build of the HT, constructing the actual hash table and making the HT ready for probing.
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
 	//! ever called.
@@ -190,6 +235,15 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! The heavy hitters of the build side, sorted by hash
+	vector<HeavyHitter> heavy_hitters;
+
+	//! The number of build rows sampled to detect heavy hitters
+	static constexpr const idx_t HEAVY_HITTER_SAMPLE_SIZE = 8 * STANDARD_VECTOR_SIZE;
+	//! The minimum number of times a heavy hitter occurs in the sample
+	static constexpr const idx_t HEAVY_HITTER_SAMPLE_COUNT = 8;
+	//! The minimum (estimated) number of build rows of a heavy hitter
+	static constexpr const idx_t HEAVY_HITTER_THRESHOLD = STANDARD_VECTOR_SIZE;
 
 	struct {
 		mutex mj_lock;
@@ -216,6 +270,10 @@ private:
 	//! Apply a bitmask to the hashes
 	void ApplyBitmask(Vector &hashes, idx_t count);
 	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Returns the index of the heavy hitter with the given hash, or DConstants::INVALID_INDEX
+	idx_t FindHeavyHitter(hash_t hash) const;
+	//! Move the probe rows with a heavy hitter key out of the selection that is probed through the pointer table
+	void SelectHeavyHitters(ScanStructure &ss, Vector &hashes, const SelectionVector *&current_sel);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
@@ -226,6 +284,8 @@ private:
 
 	//! Lock for combining data_collection when merging HTs
 	mutex data_lock;
+	//! Lock for collecting the heavy hitter rows during a parallel Finalize
+	mutex heavy_hitter_lock;
 	//! Partitioned data collection that the data is sunk into when building
 	unique_ptr<PartitionedTupleData> sink_collection;
 	//! The DataCollection holding the main data of the hash table
@@ -17,7 +17,11 @@ class GroupedAggregateData;
 
 struct DistinctAggregateCollectionInfo {
 public:
-	DistinctAggregateCollectionInfo(const vector<unique_ptr<Expression>> &aggregates, vector<idx_t> indices);
+	DistinctAggregateCollectionInfo(const vector<unique_ptr<Expression>> &aggregates, vector<idx_t> indices,
+	                                bool expand_inputs = false);
+
+	//! The maximum amount of distinct inputs that can share an expanded table (the tag is stored as UTINYINT)
+	static constexpr idx_t MAX_EXPANDED_INPUTS = 256;
 
 public:
 	// The indices of the aggregates that are distinct
@@ -28,18 +32,26 @@ public:
 	vector<idx_t> table_indices;
 	//! This indirection is used to allow two aggregates to share the same input data
 	unordered_map<idx_t, idx_t> table_map;
+	//! For every table, the aggregates that provide its distinct inputs, indexed by the tag of the input
+	vector<vector<idx_t>> table_inputs;
+	//! Whether the table is expanded, i.e., it stores the (single-column) distinct inputs of several aggregates,
+	//! keyed on the groups, the tag of the input and the input value
+	vector<bool> expanded_tables;
+	//! The tag of the distinct input of the aggregate within its table
+	unordered_map<idx_t, idx_t> tag_map;
 	const vector<unique_ptr<Expression>> &aggregates;
 	// Total amount of children of the distinct aggregates
 	idx_t total_child_count;
 
 public:
-	static unique_ptr<DistinctAggregateCollectionInfo> Create(vector<unique_ptr<Expression>> &aggregates);
+	static unique_ptr<DistinctAggregateCollectionInfo> Create(vector<unique_ptr<Expression>> &aggregates,
+	                                                          bool expand_inputs = false);
 	const unsafe_vector<idx_t> &Indices() const;
 	bool AnyDistinct() const;
 
 private:
 	//! Returns the amount of tables that are occupied
-	idx_t CreateTableIndexMap();
+	idx_t CreateTableIndexMap(bool expand_inputs);
 };
 
 struct DistinctAggregateData {
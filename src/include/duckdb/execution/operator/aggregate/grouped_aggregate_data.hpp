@@ -46,6 +46,9 @@ public:
 
 	//! Initialize a GroupedAggregateData object for use with distinct aggregates
 	void InitializeDistinct(const unique_ptr<Expression> &aggregate, const vector<unique_ptr<Expression>> *groups_p);
+	//! Initialize a GroupedAggregateData object for the distinct inputs of several aggregates, that are keyed on
+	//! (groups, tag, value). The groups reference the columns [0, group count), followed by the tag and the value
+	void InitializeDistinctExpanded(const LogicalType &value_type, const vector<unique_ptr<Expression>> *groups_p);
 
 private:
 	void InitializeDistinctGroups(const vector<unique_ptr<Expression>> *groups);
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+//! PhysicalStreamingAggregate computes a grouped aggregate over input that is sorted on the groups. Only the state of
+//! the current group is kept around: a group is finalized as soon as the next group starts.
+class PhysicalStreamingAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_GROUP_BY;
+
+public:
+	PhysicalStreamingAggregate(vector<LogicalType> types, vector<unique_ptr<Expression>> groups,
+	                           vector<unique_ptr<Expression>> aggregates, idx_t estimated_cardinality);
+
+	//! The groups (references to the sorted input columns)
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed (children and filters reference the input columns)
+	vector<unique_ptr<Expression>> aggregates;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const override;
+
+	bool RequiresFinalExecute() const override {
+		return true;
+	}
+	//! Groups are only complete when the input is processed in order by a single thread
+	bool ParallelOperator() const override {
+		return false;
+	}
+	OrderPreservationType OperatorOrder() const override {
+		return OrderPreservationType::FIXED_ORDER;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
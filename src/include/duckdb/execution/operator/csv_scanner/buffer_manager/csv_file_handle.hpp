@@ -30,6 +30,8 @@ public:
 	bool OnDiskFile();
 
 	idx_t FileSize();
+	//! Last modification time of the file, only available for seekable on-disk files
+	time_t GetLastModifiedTime();
 
 	bool FinishedReading();
 
@@ -112,6 +112,30 @@ protected:
 	//! Initializes the scanner
 	virtual void Initialize();
 
+	//! Skips over 8 bytes at a time in the Standard State, until a word with a delimiter or new line is found
+	inline void SkipStandard(const idx_t to_pos) {
+		auto &transition_array = state_machine->transition_array;
+		while (iterator.pos.buffer_pos + sizeof(uint64_t) < to_pos) {
+			auto value = Load<uint64_t>(const_data_ptr_cast(buffer_handle_ptr + iterator.pos.buffer_pos));
+			if (transition_array.ContainsStandardStructural(value)) {
+				break;
+			}
+			iterator.pos.buffer_pos += sizeof(uint64_t);
+		}
+	}
+
+	//! Skips over 8 bytes at a time in the Quoted State, until a word with a quote, escape or new line is found
+	inline void SkipQuoted(const idx_t to_pos) {
+		auto &transition_array = state_machine->transition_array;
+		while (iterator.pos.buffer_pos + sizeof(uint64_t) < to_pos) {
+			auto value = Load<uint64_t>(const_data_ptr_cast(buffer_handle_ptr + iterator.pos.buffer_pos));
+			if (transition_array.ContainsQuotedStructural(value)) {
+				break;
+			}
+			iterator.pos.buffer_pos += sizeof(uint64_t);
+		}
+	}
+
 	//! Process one chunk
 	template <class T>
 	void Process(T &result) {
@@ -178,6 +202,7 @@ protected:
 				}
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
+				SkipQuoted(to_pos);
 				while (state_machine->transition_array
 				           .skip_quoted[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
 				       iterator.pos.buffer_pos < to_pos - 1) {
@@ -190,6 +215,7 @@ protected:
 				break;
 			case CSVState::STANDARD:
 				iterator.pos.buffer_pos++;
+				SkipStandard(to_pos);
 				while (state_machine->transition_array
 				           .skip_standard[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
 				       iterator.pos.buffer_pos < to_pos - 1) {
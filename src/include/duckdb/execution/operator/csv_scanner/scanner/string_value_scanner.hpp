@@ -181,6 +181,14 @@ private:
 
 	void SetStart();
 
+	//! Casts a parsed column to the result type, keeps track of the rows that failed to cast
+	//! If sel is set, the parse vector is a slice of the parsed column with the given selection
+	bool CastColumn(DataChunk &parse_chunk, idx_t col_idx, Vector &parse_vector, Vector &result_vector, idx_t count,
+	                optional_ptr<SelectionVector> sel, unordered_set<idx_t> &borked_lines);
+
+	//! Removes the rows that failed to cast from the result chunk
+	static void RemoveBorkedLines(DataChunk &insert_chunk, const unordered_set<idx_t> &borked_lines);
+
 	StringValueResult result;
 	vector<LogicalType> types;
 
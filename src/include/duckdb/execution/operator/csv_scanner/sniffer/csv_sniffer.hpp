@@ -12,6 +12,8 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/execution/operator/csv_scanner/sniffer/quote_rules.hpp"
 #include "duckdb/execution/operator/csv_scanner/scanner/column_count_scanner.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "duckdb/common/types/hash.hpp"
 
 namespace duckdb {
 struct DateTimestampSniffing {
@@ -29,6 +31,47 @@ struct SnifferResult {
 	vector<string> names;
 };
 
+//! Result of sniffing a CSV file, stored in the object cache to avoid sniffing the same file over and over again
+//! The result is only reused if the size and modification time of the file did not change, and if the first buffer
+//! of the file still has the same contents
+class CSVSnifferCacheEntry : public ObjectCacheEntry {
+public:
+	CSVSnifferCacheEntry(DialectOptions dialect_options_p, string sniffer_user_mismatch_error_p,
+	                     SnifferResult result_p, idx_t file_size_p, time_t last_modified_p, hash_t first_buffer_hash_p)
+	    : dialect_options(std::move(dialect_options_p)),
+	      sniffer_user_mismatch_error(std::move(sniffer_user_mismatch_error_p)), result(std::move(result_p)),
+	      file_size(file_size_p), last_modified(last_modified_p), first_buffer_hash(first_buffer_hash_p) {
+	}
+	~CSVSnifferCacheEntry() override = default;
+
+	//! The dialect options resulting from sniffing
+	DialectOptions dialect_options;
+	//! Mismatches between the sniffed and user-set options
+	string sniffer_user_mismatch_error;
+	//! The detected types and names
+	SnifferResult result;
+	//! Size of the file when it was sniffed
+	idx_t file_size;
+	//! Modification time of the file when it was sniffed
+	time_t last_modified;
+	//! Hash of the first buffer of the file when it was sniffed
+	hash_t first_buffer_hash;
+
+	//! Whether or not the cached result still holds for a file with this size and modification time
+	bool IsValid(idx_t file_size_p, time_t last_modified_p) const {
+		return file_size == file_size_p && last_modified == last_modified_p;
+	}
+
+public:
+	static string ObjectType() {
+		return "csv_sniffer_result";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+};
+
 //! This represents the data related to columns that have been set by the user
 //! e.g., from a copy command
 struct SetColumns {
@@ -87,6 +130,7 @@ public:
 	//! 3. Type Refinement: Refines the types of the columns for the remaining chunks
 	//! 4. Header Detection: Figures out if  the CSV file has a header and produces the names of the columns
 	//! 5. Type Replacement: Replaces the types of the columns if the user specified them
+	//! If the object cache is enabled, the result of sniffing the same file with the same options is cached
 	SnifferResult SniffCSV(bool force_match = false);
 
 	static NewLineIdentifier DetectNewLineDelimiter(CSVBufferManager &buffer_manager);
@@ -109,6 +153,13 @@ private:
 	//! Sets the result options
 	void SetResultOptions();
 
+	//! Runs all sniffing phases
+	SnifferResult SniffCSVInternal(bool force_match);
+	//! Returns the key of this file and options in the object cache, or an empty string if it can't be cached
+	string GetCacheKey();
+	//! Hashes the first buffer of the file, which is used to re-validate a cached result
+	hash_t HashFirstBuffer();
+
 	//! ------------------------------------------------------//
 	//! ----------------- Dialect Detection ----------------- //
 	//! ------------------------------------------------------//
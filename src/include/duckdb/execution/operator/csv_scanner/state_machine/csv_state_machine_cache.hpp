@@ -27,6 +27,32 @@ public:
 	bool skip_standard[256];
 	//! For the Quoted State
 	bool skip_quoted[256];
+	//! Structural characters broadcast to every byte of a 64-bit word
+	//! These are used to skip over 8 bytes at a time in the Standard and Quoted States
+	uint64_t delimiter = 0;
+	uint64_t new_line = 0;
+	uint64_t carriage_return = 0;
+	uint64_t quote = 0;
+	uint64_t escape = 0;
+
+	//! Broadcasts a character to all bytes of a 64-bit word
+	static inline uint64_t Broadcast(uint8_t c) {
+		return 0x0101010101010101ULL * c;
+	}
+	//! Returns true if any byte of the word is zero
+	static inline bool ContainsZeroByte(uint64_t v) {
+		return ((v - 0x0101010101010101ULL) & ~v & 0x8080808080808080ULL) != 0;
+	}
+	//! Returns true if any byte of the 8-byte word is a delimiter or a new line in the Standard State
+	inline bool ContainsStandardStructural(uint64_t v) const {
+		return ContainsZeroByte(v ^ delimiter) || ContainsZeroByte(v ^ new_line) ||
+		       ContainsZeroByte(v ^ carriage_return);
+	}
+	//! Returns true if any byte of the 8-byte word is a quote, escape or new line in the Quoted State
+	inline bool ContainsQuotedStructural(uint64_t v) const {
+		return ContainsZeroByte(v ^ quote) || ContainsZeroByte(v ^ escape) || ContainsZeroByte(v ^ new_line) ||
+		       ContainsZeroByte(v ^ carriage_return);
+	}
 
 	const CSVState *operator[](idx_t i) const {
 		return state_machine[i];
@@ -23,7 +23,7 @@ struct CSVGlobalState : public GlobalTableFunctionState {
 public:
 	CSVGlobalState(ClientContext &context, const shared_ptr<CSVBufferManager> &buffer_manager_p,
 	               const CSVReaderOptions &options, idx_t system_threads_p, const vector<string> &files,
-	               vector<column_t> column_ids_p, const ReadCSVData &bind_data);
+	               vector<column_t> column_ids_p, optional_ptr<TableFilterSet> filters_p, const ReadCSVData &bind_data);
 
 	~CSVGlobalState() override {
 	}
@@ -60,6 +60,8 @@ private:
 	idx_t running_threads = 1;
 	//! The column ids to read
 	vector<column_t> column_ids;
+	//! The table filters pushed down into the scan
+	optional_ptr<TableFilterSet> filters;
 
 	string sniffer_mismatch_error;
 
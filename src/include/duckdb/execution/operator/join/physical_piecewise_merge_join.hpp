@@ -15,7 +15,7 @@ namespace duckdb {
 
 class MergeJoinGlobalState;
 
-//! PhysicalPiecewiseMergeJoin represents a piecewise merge loop join between
+//! PhysicalPiecewiseMergeJoin represents a piecewise merge loop join on a range or equality predicate between
 //! two tables
 class PhysicalPiecewiseMergeJoin : public PhysicalRangeJoin {
 public:
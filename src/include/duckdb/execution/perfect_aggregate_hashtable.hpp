@@ -26,11 +26,23 @@ public:
 
 	//! Combines the target perfect aggregate HT into this one
 	void Combine(PerfectAggregateHashTable &other);
+	//! Combines a single page of the target perfect aggregate HT into this one. Different pages can be combined
+	//! concurrently, after all pages are combined TakeAllocators must be called
+	void CombinePage(PerfectAggregateHashTable &other, idx_t page_idx);
+	//! Takes ownership of the arena allocators of the target perfect aggregate HT
+	void TakeAllocators(PerfectAggregateHashTable &other);
+	//! The amount of pages in the HT
+	idx_t PageCount() const {
+		return pages.size();
+	}
 
 	//! Scan the HT starting from the scan_position
 	void Scan(idx_t &scan_position, DataChunk &result);
 
 protected:
+	//! The HT is split into pages of (at most) 2^PAGE_BITS groups, that are only allocated once a group in them is set
+	static constexpr idx_t PAGE_BITS = 12;
+
 	Vector addresses;
 	//! The required bits per group
 	vector<idx_t> required_bits;
@@ -43,12 +55,12 @@ protected:
 	//! The number of grouping columns
 	idx_t grouping_columns;
 
-	// The actual pointer to the data
-	data_ptr_t data;
-	//! The owned data of the HT
-	unsafe_unique_array<data_t> owned_data;
-	//! Information on whether or not a specific group has any entries
-	unsafe_unique_array<bool> group_is_set;
+	//! The amount of groups in a page (as a power of two)
+	idx_t page_bits;
+	//! The pages of the HT, nullptr if no group in the page has been set yet
+	vector<unsafe_unique_array<data_t>> pages;
+	//! Information on whether or not a specific group has any entries, per page
+	vector<unsafe_unique_array<bool>> group_is_set;
 
 	//! The minimum values for each of the group columns
 	vector<Value> group_minima;
@@ -62,6 +74,8 @@ protected:
 	vector<unique_ptr<ArenaAllocator>> stored_allocators;
 
 private:
+	//! Allocates a page and initializes the states of its groups
+	void InitializePage(idx_t page_idx);
 	//! Destroy the perfect aggregate HT (called automatically by the destructor)
 	void Destroy();
 };
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/logical_operator.hpp"
 #include "duckdb/planner/logical_tokens.hpp"
@@ -47,6 +48,9 @@ public:
 	static bool PreserveInsertionOrder(ClientContext &context, PhysicalOperator &plan);
 
 	static bool HasEquality(vector<JoinCondition> &conds, idx_t &range_count);
+	//! Returns the column that the expression references, if it preserves the order (and thus the distinctness) of
+	//! that column: column references, and the functions that compressed materialization uses to (de)compress
+	static optional_idx GetOrderPreservingColumn(const Expression &expr);
 
 protected:
 	unique_ptr<PhysicalOperator> CreatePlan(LogicalOperator &op);
@@ -39,6 +39,9 @@ public:
 
 	void Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input, DataChunk &aggregate_input_chunk,
 	          const unsafe_vector<idx_t> &filter) const;
+	//! Sink with precomputed hashes of the groups in the grouping set
+	void Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input, DataChunk &aggregate_input_chunk,
+	          const unsafe_vector<idx_t> &filter, Vector &group_hashes) const;
 	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const;
 	void Finalize(ClientContext &context, GlobalSinkState &gstate) const;
 
@@ -57,6 +60,9 @@ public:
 	static void SetMultiScan(GlobalSinkState &sink);
 
 private:
+	void SinkInternal(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
+	                  DataChunk &aggregate_input_chunk, const unsafe_vector<idx_t> &filter,
+	                  optional_ptr<Vector> group_hashes) const;
 	void SetGroupingValues();
 	void PopulateGroupChunk(DataChunk &group_chunk, DataChunk &input_chunk) const;
 
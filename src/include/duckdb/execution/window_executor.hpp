@@ -148,6 +148,12 @@ public:
 
 	virtual void Finalize() {
 	}
+	//! The number of tasks that complete Finalize, which can run concurrently
+	virtual idx_t GetFinalizeTasks() const {
+		return 0;
+	}
+	virtual void FinalizeTask(idx_t task_idx) {
+	}
 
 	virtual unique_ptr<WindowExecutorState> GetExecutorState() const;
 
@@ -177,6 +183,7 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsPrefixSumAggregate();
 
 	WindowAggregateExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
 	                        const ValidityMask &partition_mask, const ValidityMask &order_mask,
@@ -184,9 +191,16 @@ public:
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
 	void Finalize() override;
+	idx_t GetFinalizeTasks() const override;
+	void FinalizeTask(idx_t task_idx) override;
 
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
+	//! Whether this executor can evaluate its frames with the aggregator of "other"
+	bool CanShareAggregator(const WindowAggregateExecutor &other) const;
+	//! Use the aggregator of "other" instead of building an identical one
+	void ShareAggregator(const WindowAggregateExecutor &other);
+
 	const WindowAggregationMode mode;
 
 protected:
@@ -194,7 +208,11 @@ protected:
 	SelectionVector filter_sel;
 
 	// aggregate computation algorithm
-	unique_ptr<WindowAggregator> aggregator;
+	shared_ptr<WindowAggregator> aggregator;
+	//! Whether the aggregator only depends on the aggregate and its inputs (not on the frame)
+	bool frame_independent;
+	//! Whether the aggregator is built by another executor
+	bool shared;
 
 	void EvaluateInternal(WindowExecutorState &lstate, Vector &result, idx_t count, idx_t row_idx) const override;
 };
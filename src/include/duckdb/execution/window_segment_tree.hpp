@@ -56,6 +56,12 @@ public:
 	//	Build
 	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize(const FrameStats &stats);
+	//! The number of tasks that complete Finalize, which can run concurrently
+	virtual idx_t GetFinalizeTasks() const {
+		return 0;
+	}
+	virtual void FinalizeTask(idx_t task_idx) {
+	}
 
 	//	Probe
 	virtual unique_ptr<WindowAggregatorState> GetLocalState() const = 0;
@@ -152,6 +158,33 @@ public:
 	unique_ptr<WindowAggregatorState> gstate;
 };
 
+//! Evaluates invertible aggregates (SUM, COUNT and AVG of integers) as differences of prefix sums,
+//! so each frame takes constant time however far it slides
+class WindowPrefixSumAggregator : public WindowAggregator {
+public:
+	enum class PrefixSumFunction : uint8_t { COUNT, SUM, AVG };
+
+	WindowPrefixSumAggregator(AggregateObject aggr, const LogicalType &result_type_p,
+	                          const WindowExcludeMode exclude_mode_p, idx_t partition_count);
+	~WindowPrefixSumAggregator() override;
+
+	//! Whether the aggregate can be computed from prefix sums (with exactly the same result)
+	static bool CanAggregate(const AggregateObject &aggr, const LogicalType &result_type);
+
+	void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState() const override;
+	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
+	              idx_t row_idx) const override;
+
+	//! The function computed from the prefix sums
+	const PrefixSumFunction function;
+	//! The number of aggregated values before each row
+	vector<uint64_t> counts;
+	//! The sum of the aggregated values before each row (empty for COUNT)
+	vector<hugeint_t> sums;
+};
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
@@ -160,13 +193,18 @@ public:
 	~WindowSegmentTree() override;
 
 	void Finalize(const FrameStats &stats) override;
+	idx_t GetFinalizeTasks() const override;
+	void FinalizeTask(idx_t task_idx) override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
 	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
 	              idx_t row_idx) const override;
 
 public:
-	void ConstructTree();
+	//! Allocate the tree, its levels are built by the finalize tasks
+	void InitializeTree();
+	//! Build the nodes [begin, end) on top of the given level (0 being the inputs)
+	void ConstructLevel(WindowAggregatorState &lstate, idx_t level, idx_t begin, idx_t end);
 
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
@@ -184,8 +222,15 @@ public:
 	//! Use the combine API, if available
 	WindowAggregationMode mode;
 
+	//! The states of the finalize tasks, which own the memory of the nodes they built
+	vector<unique_ptr<WindowAggregatorState>> task_states;
+	//! The number of finished finalize tasks
+	atomic<idx_t> finished_tasks;
+
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! The number of first level nodes built by a single finalize task
+	static constexpr idx_t TASK_NODES = STANDARD_VECTOR_SIZE;
 };
 
 class WindowDistinctAggregator : public WindowAggregator {
@@ -20,6 +20,10 @@ namespace regexp_util {
 bool TryParseConstantPattern(ClientContext &context, Expression &expr, string &constant_string);
 void ParseRegexOptions(const string &options, duckdb_re2::RE2::Options &result, bool *global_replace = nullptr);
 void ParseRegexOptions(ClientContext &context, Expression &expr, RE2::Options &target, bool *global_replace = nullptr);
+//! Extracts a literal that every match of the pattern must contain, returns false if there is none
+bool TryExtractRequiredLiteral(const duckdb_re2::RE2 &pattern, string &result);
+//! Whether or not the input contains the (non-empty) literal
+bool ContainsLiteral(const string_t &input, const string &literal);
 
 inline duckdb_re2::StringPiece CreateStringPiece(const string_t &input) {
 	return duckdb_re2::StringPiece(input.GetData(), input.GetSize());
@@ -56,11 +60,13 @@ struct RegexpBaseBindData : public FunctionData {
 struct RegexpMatchesBindData : public RegexpBaseBindData {
 	RegexpMatchesBindData(duckdb_re2::RE2::Options options, string constant_string, bool constant_pattern);
 	RegexpMatchesBindData(duckdb_re2::RE2::Options options, string constant_string, bool constant_pattern,
-	                      string range_min, string range_max, bool range_success);
+	                      string range_min, string range_max, bool range_success, bool anchored_start);
 
 	string range_min;
 	string range_max;
 	bool range_success;
+	//! Whether or not matches have to start at the beginning of the string (i.e. the pattern starts with ^)
+	bool anchored_start;
 
 	unique_ptr<FunctionData> Copy() const override;
 };
@@ -144,9 +150,14 @@ struct RegexLocalState : public FunctionLocalState {
 			}
 		}
 		D_ASSERT(info.constant_pattern);
+		has_required_literal = regexp_util::TryExtractRequiredLiteral(constant_pattern, required_literal);
 	}
 
 	RE2 constant_pattern;
+	//! Whether or not every match of the pattern contains required_literal
+	bool has_required_literal;
+	//! A literal that every match contains - rows without it can skip the regex
+	string required_literal;
 	//! Used by regexp_extract_all to pre-allocate the args
 	RegexStringPieceArgs group_buffer;
 };
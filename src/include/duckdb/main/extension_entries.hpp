@@ -70,6 +70,7 @@ static constexpr ExtensionEntry EXTENSION_FUNCTIONS[] = {{"->>", "json"},
                                                          {"json_valid", "json"},
                                                          {"load_aws_credentials", "aws"},
                                                          {"make_timestamptz", "icu"},
+                                                         {"parquet_bloom_probe", "parquet"},
                                                          {"parquet_file_metadata", "parquet"},
                                                          {"parquet_kv_metadata", "parquet"},
                                                          {"parquet_metadata", "parquet"},
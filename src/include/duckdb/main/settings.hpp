@@ -105,6 +105,15 @@ struct PreferRangeJoins {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct PreferMergeJoins {
+	static constexpr const char *Name = "prefer_merge_joins";                                                   // NOLINT
+	static constexpr const char *Description = "Force use of merge joins for equality predicates, if possible"; // NOLINT
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;                                    // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct DebugWindowMode {
 	static constexpr const char *Name = "debug_window_mode";
 	static constexpr const char *Description = "DEBUG SETTING: switch window mode to use";
@@ -438,7 +447,7 @@ struct PasswordSetting {
 
 struct PerfectHashThresholdSetting {
 	static constexpr const char *Name = "perfect_ht_threshold";
-	static constexpr const char *Description = "Threshold in bytes for when to use a perfect hash table (default: 12)";
+	static constexpr const char *Description = "Threshold in bytes for when to use a perfect hash table (default: 16)";
 	static constexpr const LogicalTypeId InputType = LogicalTypeId::BIGINT;
 	static void SetLocal(ClientContext &context, const Value &parameter);
 	static void ResetLocal(ClientContext &context);
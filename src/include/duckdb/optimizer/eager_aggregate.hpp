@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/eager_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+
+class Binder;
+class BoundAggregateExpression;
+class ClientContext;
+
+//! The EagerAggregate optimizer pushes a partial aggregate below an inner join when all aggregate inputs come from one
+//! side of the join, and the statistics predict that grouping that side on its join keys greatly reduces its size
+//! e.g., SELECT d.region, SUM(f.amount) FROM facts f JOIN dims d USING (k) GROUP BY d.region
+//! pre-aggregates SUM(f.amount) per f.k, so the join only has to process one row per key instead of every fact row
+class EagerAggregate {
+public:
+	EagerAggregate(ClientContext &context, Binder &binder);
+
+	//! The minimum estimated number of input rows per group to pre-aggregate a side of a join
+	static constexpr const double MINIMUM_REDUCTION = 10;
+
+public:
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	void OptimizeInternal(unique_ptr<LogicalOperator> &op);
+	//! Try to push a partial aggregate below the join that is the child of the aggregate in "op"
+	bool TryPushdown(unique_ptr<LogicalOperator> &op);
+	//! Whether the aggregate can be computed by re-aggregating partial aggregates
+	static bool CanSplitAggregate(const BoundAggregateExpression &aggr);
+	//! Create the aggregate that combines the partial aggregates in "input"
+	unique_ptr<Expression> CombinePartialAggregate(BoundAggregateExpression &aggr, unique_ptr<Expression> input);
+
+	//! Estimate the number of distinct values of the combination of the columns, returns 0 if unknown
+	double EstimateDistinctCount(LogicalOperator &op, const vector<ColumnBinding> &bindings);
+	//! Estimate the number of distinct values of a column using the HyperLogLog statistics of the base table
+	idx_t GetDistinctCount(LogicalOperator &op, const ColumnBinding &binding);
+
+private:
+	ClientContext &context;
+	Binder &binder;
+	//! Replaces the bindings of aggregates that had to be wrapped in a projection (to cast their results back)
+	ColumnBindingReplacer replacer;
+};
+
+} // namespace duckdb
@@ -237,6 +237,21 @@ Value PreferRangeJoins::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).prefer_range_joins);
 }
 
+//===--------------------------------------------------------------------===//
+// Prefer Merge Joins
+//===--------------------------------------------------------------------===//
+void PreferMergeJoins::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).prefer_merge_joins = ClientConfig().prefer_merge_joins;
+}
+
+void PreferMergeJoins::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).prefer_merge_joins = input.GetValue<bool>();
+}
+
+Value PreferMergeJoins::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).prefer_merge_joins);
+}
+
 //===--------------------------------------------------------------------===//
 // Default Collation
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,303 @@
+#include "duckdb/optimizer/eager_aggregate.hpp"
+
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+EagerAggregate::EagerAggregate(ClientContext &context, Binder &binder) : context(context), binder(binder) {
+}
+
+unique_ptr<LogicalOperator> EagerAggregate::Optimize(unique_ptr<LogicalOperator> op) {
+	OptimizeInternal(op);
+	if (!replacer.replacement_bindings.empty()) {
+		replacer.VisitOperator(*op);
+	}
+	return op;
+}
+
+void EagerAggregate::OptimizeInternal(unique_ptr<LogicalOperator> &op) {
+	for (auto &child : op->children) {
+		OptimizeInternal(child);
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		TryPushdown(op);
+	}
+}
+
+bool EagerAggregate::CanSplitAggregate(const BoundAggregateExpression &aggr) {
+	if (aggr.IsDistinct() || aggr.order_bys) {
+		return false;
+	}
+	auto &name = aggr.function.name;
+	return name == "sum" || name == "sum_no_overflow" || name == "count" || name == "count_star" || name == "min" ||
+	       name == "max";
+}
+
+unique_ptr<Expression> EagerAggregate::CombinePartialAggregate(BoundAggregateExpression &aggr,
+                                                               unique_ptr<Expression> input) {
+	auto &name = aggr.function.name;
+	if (name == "min" || name == "max") {
+		// MIN/MAX return the type of their input: the aggregate itself combines the partial aggregates
+		auto result = aggr.Copy();
+		auto &result_aggr = result->Cast<BoundAggregateExpression>();
+		result_aggr.children.clear();
+		result_aggr.children.push_back(std::move(input));
+		result_aggr.filter.reset();
+		return result;
+	}
+	// SUM and COUNT are combined by summing up the partial aggregates
+	QueryErrorContext error_context;
+	auto &func = Catalog::GetEntry<AggregateFunctionCatalogEntry>(context, SYSTEM_CATALOG, DEFAULT_SCHEMA, "sum",
+	                                                              error_context);
+	FunctionBinder function_binder(context);
+	ErrorData error;
+	auto best_function = function_binder.BindFunction(func.name, func.functions, {input->return_type}, error);
+	if (best_function == DConstants::INVALID_INDEX) {
+		return nullptr;
+	}
+	auto bound_function = func.functions.GetFunctionByOffset(best_function);
+	vector<unique_ptr<Expression>> children;
+	children.push_back(std::move(input));
+	return function_binder.BindAggregateFunction(bound_function, std::move(children), nullptr,
+	                                             AggregateType::NON_DISTINCT);
+}
+
+static void GetColumnReferences(Expression &expr, vector<unique_ptr<BoundColumnRefExpression>> &result) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		result.push_back(unique_ptr_cast<Expression, BoundColumnRefExpression>(expr.Copy()));
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { GetColumnReferences(child, result); });
+}
+
+static bool ReferencesOnly(Expression &expr, const unordered_set<idx_t> &tables) {
+	unordered_set<idx_t> bindings;
+	LogicalJoin::GetExpressionBindings(expr, bindings);
+	for (auto &table_index : bindings) {
+		if (tables.find(table_index) == tables.end()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool EagerAggregate::TryPushdown(unique_ptr<LogicalOperator> &op) {
+	auto &aggr = op->Cast<LogicalAggregate>();
+	if (aggr.groups.empty() || aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty()) {
+		// the partial aggregates of an ungrouped aggregate over an empty join cannot be combined (COUNT would be NULL)
+		return false;
+	}
+	if (aggr.children[0]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return false;
+	}
+	auto &join = aggr.children[0]->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER || !join.left_projection_map.empty() ||
+	    !join.right_projection_map.empty()) {
+		return false;
+	}
+	for (auto &expr : aggr.expressions) {
+		if (expr->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE ||
+		    !CanSplitAggregate(expr->Cast<BoundAggregateExpression>())) {
+			return false;
+		}
+	}
+
+	// find the side of the join that all aggregate inputs come from (preferring the probe side)
+	idx_t side;
+	unordered_set<idx_t> side_tables;
+	for (side = 0; side < 2; side++) {
+		side_tables.clear();
+		LogicalJoin::GetTableReferences(*join.children[side], side_tables);
+		bool all_inputs = true;
+		for (auto &expr : aggr.expressions) {
+			all_inputs = all_inputs && ReferencesOnly(*expr, side_tables);
+		}
+		if (all_inputs) {
+			break;
+		}
+	}
+	if (side == 2) {
+		return false;
+	}
+
+	// the partial aggregate groups on every column of that side that is used by the join or by the groups
+	vector<unique_ptr<BoundColumnRefExpression>> references;
+	for (auto &cond : join.conditions) {
+		GetColumnReferences(side == 0 ? *cond.left : *cond.right, references);
+	}
+	for (auto &group : aggr.groups) {
+		GetColumnReferences(*group, references);
+	}
+	vector<unique_ptr<Expression>> partial_groups;
+	vector<ColumnBinding> partial_bindings;
+	column_binding_set_t seen;
+	for (auto &ref : references) {
+		if (side_tables.find(ref->binding.table_index) == side_tables.end() || seen.count(ref->binding) != 0) {
+			continue;
+		}
+		seen.insert(ref->binding);
+		partial_bindings.push_back(ref->binding);
+		partial_groups.push_back(std::move(ref));
+	}
+	if (partial_groups.empty()) {
+		// an ungrouped partial aggregate would produce a row even if that side of the join is empty
+		return false;
+	}
+
+	// only pre-aggregate if the statistics predict a large reduction
+	auto &side_op = *join.children[side];
+	auto cardinality = side_op.has_estimated_cardinality ? side_op.estimated_cardinality
+	                                                     : side_op.EstimateCardinality(context);
+	auto group_count = EstimateDistinctCount(side_op, partial_bindings);
+	if (group_count == 0 || group_count * MINIMUM_REDUCTION > double(cardinality)) {
+		return false;
+	}
+
+	// bind the aggregates that combine the partial aggregates
+	auto partial_aggregate_index = binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> combined_aggregates;
+	bool requires_cast = false;
+	for (idx_t aggr_idx = 0; aggr_idx < aggr.expressions.size(); aggr_idx++) {
+		auto &expr = *aggr.expressions[aggr_idx];
+		auto partial = make_uniq<BoundColumnRefExpression>(expr.return_type,
+		                                                   ColumnBinding(partial_aggregate_index, aggr_idx));
+		auto combined = CombinePartialAggregate(expr.Cast<BoundAggregateExpression>(), std::move(partial));
+		if (!combined) {
+			return false;
+		}
+		// COUNT is combined with SUM, which returns a wider type
+		requires_cast = requires_cast || combined->return_type != expr.return_type;
+		combined_aggregates.push_back(std::move(combined));
+	}
+
+	// create the partial aggregate below the join, the original aggregates become the partial aggregates
+	auto partial_group_index = binder.GenerateTableIndex();
+	auto partial_aggr =
+	    make_uniq<LogicalAggregate>(partial_group_index, partial_aggregate_index, std::move(aggr.expressions));
+	partial_aggr->groups = std::move(partial_groups);
+	partial_aggr->children.push_back(std::move(join.children[side]));
+	partial_aggr->estimated_cardinality = MinValue<idx_t>(cardinality, idx_t(group_count));
+	partial_aggr->has_estimated_cardinality = true;
+	join.children[side] = std::move(partial_aggr);
+	aggr.expressions = std::move(combined_aggregates);
+
+	// the join and the groups now reference the groups of the partial aggregate
+	ColumnBindingReplacer group_replacer;
+	for (idx_t group_idx = 0; group_idx < partial_bindings.size(); group_idx++) {
+		group_replacer.replacement_bindings.emplace_back(partial_bindings[group_idx],
+		                                                 ColumnBinding(partial_group_index, group_idx));
+	}
+	for (auto &cond : join.conditions) {
+		group_replacer.VisitExpression(side == 0 ? &cond.left : &cond.right);
+	}
+	for (auto &group : aggr.groups) {
+		group_replacer.VisitExpression(&group);
+	}
+
+	if (requires_cast) {
+		// cast the combined aggregates back to their original type in a projection on top of the aggregate
+		auto old_group_index = aggr.group_index;
+		auto old_aggregate_index = aggr.aggregate_index;
+		aggr.group_index = binder.GenerateTableIndex();
+		aggr.aggregate_index = binder.GenerateTableIndex();
+		auto projection_index = binder.GenerateTableIndex();
+		vector<unique_ptr<Expression>> projections;
+		for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+			projections.push_back(make_uniq<BoundColumnRefExpression>(aggr.groups[group_idx]->return_type,
+			                                                          ColumnBinding(aggr.group_index, group_idx)));
+			replacer.replacement_bindings.emplace_back(ColumnBinding(old_group_index, group_idx),
+			                                           ColumnBinding(projection_index, projections.size() - 1));
+		}
+		auto &original_aggregates = op->children[0]->children[side]->expressions;
+		for (idx_t aggr_idx = 0; aggr_idx < aggr.expressions.size(); aggr_idx++) {
+			unique_ptr<Expression> projection = make_uniq<BoundColumnRefExpression>(
+			    aggr.expressions[aggr_idx]->return_type, ColumnBinding(aggr.aggregate_index, aggr_idx));
+			projection = BoundCastExpression::AddCastToType(context, std::move(projection),
+			                                                original_aggregates[aggr_idx]->return_type);
+			projections.push_back(std::move(projection));
+			replacer.replacement_bindings.emplace_back(ColumnBinding(old_aggregate_index, aggr_idx),
+			                                           ColumnBinding(projection_index, projections.size() - 1));
+		}
+		auto projection = make_uniq<LogicalProjection>(projection_index, std::move(projections));
+		projection->children.push_back(std::move(op));
+		op = std::move(projection);
+	}
+	op->ResolveOperatorTypes();
+	return true;
+}
+
+double EagerAggregate::EstimateDistinctCount(LogicalOperator &op, const vector<ColumnBinding> &bindings) {
+	double result = 1;
+	for (auto &binding : bindings) {
+		auto distinct_count = GetDistinctCount(op, binding);
+		if (distinct_count == 0) {
+			return 0;
+		}
+		result *= double(distinct_count);
+	}
+	return result;
+}
+
+idx_t EagerAggregate::GetDistinctCount(LogicalOperator &op, const ColumnBinding &binding) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		// only the statistics of catalog tables have (HyperLogLog) distinct counts
+		if (get.table_index != binding.table_index || !get.function.statistics || !get.GetTable() ||
+		    binding.column_index >= get.column_ids.size()) {
+			return 0;
+		}
+		auto column_id = get.column_ids[binding.column_index];
+		if (IsRowIdColumnId(column_id)) {
+			return 0;
+		}
+		auto stats = get.function.statistics(context, get.bind_data.get(), column_id);
+		return stats ? stats->GetDistinctCount() : 0;
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		if (!op.Cast<LogicalFilter>().projection_map.empty()) {
+			return 0;
+		}
+		// filters can only reduce the number of distinct values
+		return GetDistinctCount(*op.children[0], binding);
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		if (proj.table_index != binding.table_index) {
+			return 0;
+		}
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return 0;
+		}
+		return GetDistinctCount(*op.children[0], expr.Cast<BoundColumnRefExpression>().binding);
+	}
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT: {
+		for (auto &child : op.children) {
+			unordered_set<idx_t> child_tables;
+			LogicalJoin::GetTableReferences(*child, child_tables);
+			if (child_tables.find(binding.table_index) != child_tables.end()) {
+				return GetDistinctCount(*child, binding);
+			}
+		}
+		return 0;
+	}
+	default:
+		return 0;
+	}
+}
+
+} // namespace duckdb
@@ -15,6 +15,27 @@
 
 namespace duckdb {
 
+//! Computes the range of strings that start with a match of a start-anchored pattern: every such match lies in
+//! [range_min, range_max], so the string starts with the common prefix of range_min and range_max
+static bool GetPrefixRange(const RegexpMatchesBindData &info, string &range_min, string &range_max) {
+	idx_t prefix_length = 0;
+	while (prefix_length < info.range_min.size() && prefix_length < info.range_max.size() &&
+	       info.range_min[prefix_length] == info.range_max[prefix_length]) {
+		prefix_length++;
+	}
+	range_min = info.range_min.substr(0, prefix_length);
+	range_max = range_min;
+	// the upper bound is the successor of the prefix: strip trailing 0xff bytes and increment the last byte
+	while (!range_max.empty() && static_cast<unsigned char>(range_max.back()) == 0xff) {
+		range_max.pop_back();
+	}
+	if (range_max.empty()) {
+		return false;
+	}
+	range_max.back() = static_cast<char>(static_cast<unsigned char>(range_max.back()) + 1);
+	return true;
+}
+
 unique_ptr<LogicalOperator> RegexRangeFilter::Rewrite(unique_ptr<LogicalOperator> op) {
 
 	for (idx_t child_idx = 0; child_idx < op->children.size(); child_idx++) {
@@ -30,19 +51,30 @@ unique_ptr<LogicalOperator> RegexRangeFilter::Rewrite(unique_ptr<LogicalOperator
 	for (auto &expr : op->expressions) {
 		if (expr->type == ExpressionType::BOUND_FUNCTION) {
 			auto &func = expr->Cast<BoundFunctionExpression>();
-			if (func.function.name != "regexp_full_match" || func.children.size() != 2) {
+			if (func.function.name != "regexp_full_match" && func.function.name != "regexp_matches") {
+				continue;
+			}
+			if (func.children.size() != 2) {
 				continue;
 			}
 			auto &info = func.bind_info->Cast<RegexpMatchesBindData>();
 			if (!info.range_success) {
 				continue;
 			}
+			string range_min = info.range_min;
+			string range_max = info.range_max;
+			if (func.function.name == "regexp_matches") {
+				// a partial match only restricts the range if it has to start at the beginning of the string
+				if (!info.anchored_start || !GetPrefixRange(info, range_min, range_max)) {
+					continue;
+				}
+			}
 			auto filter_left = make_uniq<BoundComparisonExpression>(
 			    ExpressionType::COMPARE_GREATERTHANOREQUALTO, func.children[0]->Copy(),
-			    make_uniq<BoundConstantExpression>(Value::BLOB_RAW(info.range_min)));
+			    make_uniq<BoundConstantExpression>(Value::BLOB_RAW(range_min)));
 			auto filter_right = make_uniq<BoundComparisonExpression>(
 			    ExpressionType::COMPARE_LESSTHANOREQUALTO, func.children[0]->Copy(),
-			    make_uniq<BoundConstantExpression>(Value::BLOB_RAW(info.range_max)));
+			    make_uniq<BoundConstantExpression>(Value::BLOB_RAW(range_max)));
 			auto filter_expr = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND,
 			                                                         std::move(filter_left), std::move(filter_right));
 
@@ -503,8 +503,6 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 				sel.Initialize(nullptr);
 			}
 			//! first, we scan the columns with filters, fetch their data and generate a selection vector.
-			//! get runtime statistics
-			auto start_time = high_resolution_clock::now();
 			if (table_filters) {
 				D_ASSERT(adaptive_filter);
 				D_ASSERT(ALLOW_UPDATES);
@@ -512,9 +510,17 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					auto tf_idx = adaptive_filter->permutation[i];
 					auto col_idx = column_ids[tf_idx];
 					auto &col_data = GetColumn(col_idx);
+					//! get runtime statistics
+					auto input_count = approved_tuple_count;
+					auto start_time = high_resolution_clock::now();
 					col_data.Select(transaction, state.vector_index, state.column_scans[tf_idx], result.data[tf_idx],
 					                sel, approved_tuple_count, *table_filters->filters[tf_idx]);
+					auto end_time = high_resolution_clock::now();
+					adaptive_filter->AdaptRuntimeStatistics(
+					    i, duration_cast<duration<double>>(end_time - start_time).count(), input_count,
+					    approved_tuple_count);
 				}
+				adaptive_filter->FinishChunk();
 				for (auto &table_filter : table_filters->filters) {
 					result.data[table_filter.first].Slice(sel, approved_tuple_count);
 				}
@@ -560,10 +566,6 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					}
 				}
 			}
-			auto end_time = high_resolution_clock::now();
-			if (adaptive_filter && table_filters->filters.size() > 1) {
-				adaptive_filter->AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - start_time).count());
-			}
 			D_ASSERT(approved_tuple_count > 0);
 			count = approved_tuple_count;
 		}
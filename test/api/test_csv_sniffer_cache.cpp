@@ -0,0 +1,66 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#include <fstream>
+#include <sys/stat.h>
+#include <utime.h>
+
+using namespace duckdb;
+using namespace std;
+
+// Writes a CSV file with lines of a fixed width, so modified files have the same size
+static void WriteSnifferCacheFile(const string &path, idx_t varchar_line) {
+	ofstream out(path);
+	out << "a,b\n";
+	for (idx_t i = 0; i < 1000; i++) {
+		char line[16];
+		snprintf(line, sizeof(line), "%d,%s\n", int(1000 + i), i == varchar_line ? "xxxx" : "1234");
+		out << line;
+	}
+}
+
+// Overwrites the modification time of the file, so modifications can't be detected through it
+static void SetModificationTime(const string &path, time_t last_modified) {
+	struct utimbuf times;
+	times.actime = last_modified;
+	times.modtime = last_modified;
+	REQUIRE(utime(path.c_str(), &times) == 0);
+}
+
+static string SniffedType(Connection &con, const string &path) {
+	auto result = con.Query("DESCRIBE SELECT * FROM read_csv_auto('" + path + "', buffer_size=1000)");
+	REQUIRE(!result->HasError());
+	REQUIRE(result->RowCount() == 2);
+	return result->GetValue(1, 1).ToString();
+}
+
+TEST_CASE("Test that the object cache holds sniffer results", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	auto path = TestCreatePath("sniffer_cache.csv");
+	REQUIRE_NO_FAIL(con.Query("SET enable_object_cache=true"));
+
+	WriteSnifferCacheFile(path, DConstants::INVALID_INDEX);
+	struct stat file_stat;
+	REQUIRE(stat(path.c_str(), &file_stat) == 0);
+	auto last_modified = file_stat.st_mtime;
+	REQUIRE(SniffedType(con, path) == "BIGINT");
+
+	// a file with the same size, modification time and first buffer reuses the cached result
+	WriteSnifferCacheFile(path, 999);
+	SetModificationTime(path, last_modified);
+	REQUIRE(SniffedType(con, path) == "BIGINT");
+
+	// without the cache the modification is detected
+	REQUIRE_NO_FAIL(con.Query("SET enable_object_cache=false"));
+	REQUIRE(SniffedType(con, path) == "VARCHAR");
+	REQUIRE_NO_FAIL(con.Query("SET enable_object_cache=true"));
+	REQUIRE(SniffedType(con, path) == "BIGINT");
+
+	// a modification of the first buffer invalidates the cached result
+	WriteSnifferCacheFile(path, 0);
+	SetModificationTime(path, last_modified);
+	REQUIRE(SniffedType(con, path) == "VARCHAR");
+
+	TestDeleteFile(path);
+}
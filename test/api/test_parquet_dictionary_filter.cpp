@@ -0,0 +1,55 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "duckdb/common/file_system.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test skipping Parquet row groups whose dictionaries have no value that passes the filter", "[parquet]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	if (!db.ExtensionIsLoaded("parquet")) {
+		return;
+	}
+	auto path = TestCreatePath("dictionary_filter_skip.parquet");
+	// the first row group holds 'a-*' and 'c-*', the second one 'b-*': the min/max statistics of the first row group
+	// cannot rule out 'b-5', only its dictionary can (the writer flushes a row group once it has reached its size)
+	REQUIRE_NO_FAIL(con.Query("COPY (SELECT i, CASE WHEN i >= 12288 THEN 'b-' WHEN i % 2 = 0 THEN 'a-' ELSE 'c-' END || "
+	                          "(i % 10) AS s FROM range(20480) t(i)) TO '" +
+	                          path + "' (FORMAT PARQUET, ROW_GROUP_SIZE 10240)"));
+
+	auto result = con.Query("SELECT row_group_id, row_group_num_rows, dictionary_page_offset IS NOT NULL, "
+	                        "data_page_offset FROM parquet_metadata('" +
+	                        path + "') WHERE path_in_schema = 's' ORDER BY ALL");
+	REQUIRE(CHECK_COLUMN(result, 0, {0, 1}));
+	REQUIRE(CHECK_COLUMN(result, 1, {12288, 8192}));
+	REQUIRE(CHECK_COLUMN(result, 2, {true, true}));
+	auto data_page_offset = result->GetValue(3, 0).GetValue<int64_t>();
+
+	result = con.Query("SELECT COUNT(*), SUM(i) FROM '" + path + "' WHERE s = 'b-5'");
+	REQUIRE(CHECK_COLUMN(result, 0, {819}));
+	REQUIRE(CHECK_COLUMN(result, 1, {13419315}));
+
+	// overwrite the header of the data page of the first row group: any scan that reads it fails
+	auto &fs = FileSystem::GetFileSystem(*con.context);
+	{
+		auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE);
+		data_t garbage[16];
+		memset(garbage, 0xFF, sizeof(garbage));
+		handle->Write(garbage, sizeof(garbage), idx_t(data_page_offset));
+		handle->Sync();
+	}
+	REQUIRE_FAIL(con.Query("SELECT COUNT(*) FROM '" + path + "' WHERE s = 'a-4'"));
+	REQUIRE_FAIL(con.Query("SELECT COUNT(*) FROM '" + path + "' WHERE s >= 'a-4'"));
+
+	// the scans skip the first row group without reading its data pages
+	result = con.Query("SELECT COUNT(*), SUM(i) FROM '" + path + "' WHERE s = 'b-5'");
+	REQUIRE(CHECK_COLUMN(result, 0, {819}));
+	REQUIRE(CHECK_COLUMN(result, 1, {13419315}));
+	result = con.Query("SELECT COUNT(*) FROM '" + path + "' WHERE s = 'b-1' AND i > 0");
+	REQUIRE(CHECK_COLUMN(result, 0, {819}));
+	result = con.Query("SELECT COUNT(*) FROM '" + path + "' WHERE s > 'a-9' AND s < 'c-0'");
+	REQUIRE(CHECK_COLUMN(result, 0, {8192}));
+
+	TestDeleteFile(path);
+}
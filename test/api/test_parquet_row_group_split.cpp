@@ -0,0 +1,45 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "parquet_reader.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test splitting Parquet row groups into ranges that are scanned by different threads", "[parquet]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	if (!db.ExtensionIsLoaded("parquet")) {
+		return;
+	}
+	auto path = TestCreatePath("row_group_split.parquet");
+	auto no_page_index_path = TestCreatePath("row_group_no_split.parquet");
+	string query = "COPY (SELECT i, i::VARCHAR AS s, {'a': i} AS st, [i, i + 1] AS l FROM range(400000) t(i)) TO ";
+	REQUIRE_NO_FAIL(con.Query(query + "'" + path + "' (FORMAT PARQUET, ROW_GROUP_SIZE 400000, WRITE_PAGE_INDEX true)"));
+	REQUIRE_NO_FAIL(con.Query(query + "'" + no_page_index_path + "' (FORMAT PARQUET, ROW_GROUP_SIZE 400000)"));
+
+	ParquetOptions options(*con.context);
+	ParquetReader reader(*con.context, path, options);
+	REQUIRE(reader.NumRowGroups() == 1);
+
+	// every range holds at least MINIMUM_SPLIT_ROWS rows
+	auto max_splits = 400000 / ParquetReaderSplitConfig::MINIMUM_SPLIT_ROWS;
+	REQUIRE(max_splits > 1);
+	reader.reader_data.column_ids = {0, 1, 2};
+	REQUIRE(reader.NumRowGroupSplits(0, 100) == max_splits);
+	REQUIRE(reader.NumRowGroupSplits(0, 2) == 2);
+	REQUIRE(reader.NumRowGroupSplits(0, 1) == 1);
+
+	// lists have no offset index, so a range of them would have to read all rows before it
+	reader.reader_data.column_ids = {0, 3};
+	REQUIRE(reader.NumRowGroupSplits(0, 100) == 1);
+	reader.reader_data.column_ids = {3};
+	REQUIRE(reader.NumRowGroupSplits(0, 100) == 1);
+
+	// without the page index the row group is not split either
+	ParquetReader no_page_index_reader(*con.context, no_page_index_path, options);
+	no_page_index_reader.reader_data.column_ids = {0};
+	REQUIRE(no_page_index_reader.NumRowGroupSplits(0, 100) == 1);
+
+	TestDeleteFile(path);
+	TestDeleteFile(no_page_index_path);
+}
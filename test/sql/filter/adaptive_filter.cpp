@@ -0,0 +1,68 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+// Feeds the statistics of one chunk to the filter: the predicates are given in their original order, as pairs of
+// the time spent per row and the fraction of rows that pass
+static void AdaptFilterChunk(AdaptiveFilter &filter, const duckdb::vector<pair<double, double>> &predicates) {
+	idx_t count = STANDARD_VECTOR_SIZE;
+	for (idx_t idx = 0; idx < filter.permutation.size(); idx++) {
+		auto &predicate = predicates[filter.permutation[idx]];
+		auto output_count = idx_t(double(count) * predicate.second);
+		filter.AdaptRuntimeStatistics(idx, predicate.first * double(count), count, output_count);
+		count = output_count;
+	}
+	filter.FinishChunk();
+}
+
+TEST_CASE("Test that the adaptive filter reorders conjunctions by cost and selectivity", "[filter]") {
+	auto conjunction = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
+	for (idx_t i = 0; i < 3; i++) {
+		conjunction->children.push_back(make_uniq<BoundConstantExpression>(Value::BOOLEAN(true)));
+	}
+	AdaptiveFilter filter(*conjunction);
+	REQUIRE(filter.permutation == duckdb::vector<idx_t> {0, 1, 2});
+
+	// an expensive predicate that passes most rows, a cheap one and a cheap and selective one
+	duckdb::vector<pair<double, double>> predicates {{100, 0.9}, {1, 0.5}, {1, 0.01}};
+	// the order is only changed after a number of chunks
+	AdaptFilterChunk(filter, predicates);
+	REQUIRE(filter.permutation == duckdb::vector<idx_t> {0, 1, 2});
+	for (idx_t i = 0; i < 16; i++) {
+		AdaptFilterChunk(filter, predicates);
+	}
+	REQUIRE(filter.permutation == duckdb::vector<idx_t> {2, 1, 0});
+
+	// when the data changes, the order adapts again as the old statistics decay
+	predicates = {{1, 0.01}, {1, 0.5}, {100, 0.9}};
+	for (idx_t i = 0; i < 256; i++) {
+		AdaptFilterChunk(filter, predicates);
+	}
+	REQUIRE(filter.permutation == duckdb::vector<idx_t> {0, 1, 2});
+}
+
+TEST_CASE("Test that the adaptive filter reorders table filters by cost and selectivity", "[filter]") {
+	TableFilterSet table_filters;
+	for (idx_t column_idx = 3; column_idx < 6; column_idx++) {
+		table_filters.filters[column_idx] =
+		    make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, Value::INTEGER(int32_t(column_idx)));
+	}
+	AdaptiveFilter filter(&table_filters);
+	REQUIRE(filter.permutation.size() == 3);
+
+	// the permutation holds the column indexes of the filters
+	duckdb::vector<pair<double, double>> predicates(6);
+	predicates[3] = {10, 0.9};
+	predicates[4] = {1, 0.1};
+	predicates[5] = {10, 0.5};
+	for (idx_t i = 0; i < 16; i++) {
+		AdaptFilterChunk(filter, predicates);
+	}
+	REQUIRE(filter.permutation == duckdb::vector<idx_t> {4, 5, 3});
+}
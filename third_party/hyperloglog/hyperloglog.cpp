@@ -1033,10 +1033,27 @@ double hllTau(double x) {
  * is, hdr->registers will point to an uint8_t array of HLL_REGISTERS element.
  * This is useful in order to speedup PFCOUNT when called against multiple
  * keys (no need to work with 6-bit integers encoding). */
-uint64_t hllCount(struct hllhdr *hdr, int *invalid) {
+/* Estimate the cardinality from the histogram of the register values. */
+static uint64_t hllEstimate(int *reghisto) {
     double m = HLL_REGISTERS;
     double E;
     int j;
+
+    /* Estimate cardinality form register histogram. See:
+     * "New cardinality estimation algorithms for HyperLogLog sketches"
+     * Otmar Ertl, arXiv:1702.01284 */
+    double z = m * hllTau((m-reghisto[HLL_Q+1])/(double)m);
+    for (j = HLL_Q; j >= 1; --j) {
+        z += reghisto[j];
+        z *= 0.5;
+    }
+    z += m * hllSigma(reghisto[0]/(double)m);
+    E = llroundl(HLL_ALPHA_INF*m*m/z);
+
+    return (uint64_t) E;
+}
+
+uint64_t hllCount(struct hllhdr *hdr, int *invalid) {
     int reghisto[HLL_Q+2] = {0};
 
     /* Compute register histogram */
@@ -1052,19 +1069,7 @@ uint64_t hllCount(struct hllhdr *hdr, int *invalid) {
 		return 0;
         //serverPanic("Unknown HyperLogLog encoding in hllCount()");
     }
-
-    /* Estimate cardinality form register histogram. See:
-     * "New cardinality estimation algorithms for HyperLogLog sketches"
-     * Otmar Ertl, arXiv:1702.01284 */
-    double z = m * hllTau((m-reghisto[HLL_Q+1])/(double)m);
-    for (j = HLL_Q; j >= 1; --j) {
-        z += reghisto[j];
-        z *= 0.5;
-    }
-    z += m * hllSigma(reghisto[0]/(double)m);
-    E = llroundl(HLL_ALPHA_INF*m*m/z);
-
-    return (uint64_t) E;
+    return hllEstimate(reghisto);
 }
 
 /* Call hllDenseAdd() or hllSparseAdd() according to the HLL encoding. */
@@ -1243,6 +1248,33 @@ robj *hll_merge(robj **hlls, size_t hll_count) {
 	return result;
 }
 
+int hll_merge_into(robj *target, robj *source) {
+    uint8_t max[HLL_REGISTERS];
+    struct hllhdr *hdr = (struct hllhdr *) target->ptr;
+    size_t j;
+
+    if (hdr->encoding != HLL_DENSE) return HLL_C_ERR;
+    memset(max, 0, sizeof(max));
+    if (hllMerge(max, source) == HLL_C_ERR) return HLL_C_ERR;
+    for (j = 0; j < HLL_REGISTERS; j++) {
+        if (max[j] == 0) continue;
+        hllDenseSet(hdr->registers + 1,j,max[j]);
+    }
+    HLL_INVALIDATE_CACHE(hdr);
+    return HLL_C_OK;
+}
+
+uint64_t hll_count_registers(const uint8_t *counts, size_t count) {
+    int reghisto[HLL_Q+2] = {0};
+    size_t j;
+
+    reghisto[0] = HLL_REGISTERS - (int) count;
+    for (j = 0; j < count; j++) {
+        reghisto[counts[j]]++;
+    }
+    return hllEstimate(reghisto);
+}
+
 uint64_t get_size() {
 	return HLL_DENSE_SIZE;
 }
@@ -1271,6 +1303,10 @@ void AddToLogsInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t indices
 	}
 }
 
+void AddToRegisterInternal(void *log, uint64_t index, uint8_t count) {
+	AddToLog(log, index, count);
+}
+
 void AddToSingleLogInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t indices[], uint8_t counts[], void *log) {
 	const auto o = (duckdb_hll::robj *)log;
 	duckdb_hll::hllhdr *hdr = (duckdb_hll::hllhdr *)o->ptr;
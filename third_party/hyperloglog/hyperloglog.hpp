@@ -35,6 +35,11 @@ int hll_add(robj *o, unsigned char *ele, size_t elesize);
 int hll_count(robj *o, size_t *result);
 //! Merge hll_count HyperLogLog objects into a single one. Returns NULL on failure, or the new HLL object on success.
 robj *hll_merge(robj **hlls, size_t hll_count);
+//! Merge the HyperLogLog 'source' into the dense HyperLogLog 'target'. Returns C_OK on success, or C_ERR on failure.
+int hll_merge_into(robj *target, robj *source);
+//! Returns the estimated amount of unique elements of a HyperLogLog of which only 'count' registers are non-empty,
+//! with the given register values
+uint64_t hll_count_registers(const uint8_t *counts, size_t count);
 //! Get size (in bytes) of the HLL
 uint64_t get_size();
 
@@ -49,4 +54,6 @@ void AddToLogsInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t indices
 
 void AddToSingleLogInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t indices[], uint8_t counts[], void *log);
 
+void AddToRegisterInternal(void *log, uint64_t index, uint8_t count);
+
 } // namespace duckdb